@@ -0,0 +1,69 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/assign_source_group.cmake"
+  "/root/repo/cmake/set_max_warning_level.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/rational_.dir/DependInfo.cmake"
+  "CMakeFiles/accumulator_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/addition_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/approximation_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/arena_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/big_integer_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/chars_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/conversion_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/dynamic_rational_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/evaluate_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/expected_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/expression_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/fixed_rational_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/fma_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/gcd_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/layout_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/policy_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/reduction_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/simd_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/sort_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/vector_benchmark.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/accumulator_benchmark.dir/benchmarks/accumulator_benchmark.cpp.o"
+  "CMakeFiles/accumulator_benchmark.dir/benchmarks/accumulator_benchmark.cpp.o.d"
+  "accumulator_benchmark"
+  "accumulator_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/accumulator_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
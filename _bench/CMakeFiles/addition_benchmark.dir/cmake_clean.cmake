@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/addition_benchmark.dir/benchmarks/addition_benchmark.cpp.o"
+  "CMakeFiles/addition_benchmark.dir/benchmarks/addition_benchmark.cpp.o.d"
+  "addition_benchmark"
+  "addition_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/addition_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
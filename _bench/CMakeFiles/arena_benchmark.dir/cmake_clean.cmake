@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arena_benchmark.dir/benchmarks/arena_benchmark.cpp.o"
+  "CMakeFiles/arena_benchmark.dir/benchmarks/arena_benchmark.cpp.o.d"
+  "arena_benchmark"
+  "arena_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arena_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
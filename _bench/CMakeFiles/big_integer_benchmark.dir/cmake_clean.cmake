@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/big_integer_benchmark.dir/benchmarks/big_integer_benchmark.cpp.o"
+  "CMakeFiles/big_integer_benchmark.dir/benchmarks/big_integer_benchmark.cpp.o.d"
+  "big_integer_benchmark"
+  "big_integer_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/big_integer_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/chars_benchmark.dir/benchmarks/chars_benchmark.cpp.o"
+  "CMakeFiles/chars_benchmark.dir/benchmarks/chars_benchmark.cpp.o.d"
+  "chars_benchmark"
+  "chars_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/chars_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
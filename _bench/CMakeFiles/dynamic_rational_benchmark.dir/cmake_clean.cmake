@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dynamic_rational_benchmark.dir/benchmarks/dynamic_rational_benchmark.cpp.o"
+  "CMakeFiles/dynamic_rational_benchmark.dir/benchmarks/dynamic_rational_benchmark.cpp.o.d"
+  "dynamic_rational_benchmark"
+  "dynamic_rational_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dynamic_rational_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/evaluate_benchmark.dir/benchmarks/evaluate_benchmark.cpp.o"
+  "CMakeFiles/evaluate_benchmark.dir/benchmarks/evaluate_benchmark.cpp.o.d"
+  "evaluate_benchmark"
+  "evaluate_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/evaluate_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/expression_benchmark.dir/benchmarks/expression_benchmark.cpp.o"
+  "CMakeFiles/expression_benchmark.dir/benchmarks/expression_benchmark.cpp.o.d"
+  "expression_benchmark"
+  "expression_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/expression_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fixed_rational_benchmark.dir/benchmarks/fixed_rational_benchmark.cpp.o"
+  "CMakeFiles/fixed_rational_benchmark.dir/benchmarks/fixed_rational_benchmark.cpp.o.d"
+  "fixed_rational_benchmark"
+  "fixed_rational_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fixed_rational_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fma_benchmark.dir/benchmarks/fma_benchmark.cpp.o"
+  "CMakeFiles/fma_benchmark.dir/benchmarks/fma_benchmark.cpp.o.d"
+  "fma_benchmark"
+  "fma_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fma_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
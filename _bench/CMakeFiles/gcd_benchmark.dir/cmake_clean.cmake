@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gcd_benchmark.dir/benchmarks/gcd_benchmark.cpp.o"
+  "CMakeFiles/gcd_benchmark.dir/benchmarks/gcd_benchmark.cpp.o.d"
+  "gcd_benchmark"
+  "gcd_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gcd_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
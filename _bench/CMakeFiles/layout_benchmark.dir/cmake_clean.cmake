@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/layout_benchmark.dir/benchmarks/layout_benchmark.cpp.o"
+  "CMakeFiles/layout_benchmark.dir/benchmarks/layout_benchmark.cpp.o.d"
+  "layout_benchmark"
+  "layout_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/layout_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
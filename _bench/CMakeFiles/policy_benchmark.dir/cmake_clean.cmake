@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/policy_benchmark.dir/benchmarks/policy_benchmark.cpp.o"
+  "CMakeFiles/policy_benchmark.dir/benchmarks/policy_benchmark.cpp.o.d"
+  "policy_benchmark"
+  "policy_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/policy_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
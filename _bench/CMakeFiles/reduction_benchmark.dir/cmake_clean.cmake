@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reduction_benchmark.dir/benchmarks/reduction_benchmark.cpp.o"
+  "CMakeFiles/reduction_benchmark.dir/benchmarks/reduction_benchmark.cpp.o.d"
+  "reduction_benchmark"
+  "reduction_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reduction_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vector_benchmark.dir/benchmarks/vector_benchmark.cpp.o"
+  "CMakeFiles/vector_benchmark.dir/benchmarks/vector_benchmark.cpp.o.d"
+  "vector_benchmark"
+  "vector_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vector_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/approximation_benchmark.dir/benchmarks/approximation_benchmark.cpp.o"
+  "CMakeFiles/approximation_benchmark.dir/benchmarks/approximation_benchmark.cpp.o.d"
+  "approximation_benchmark"
+  "approximation_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/approximation_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
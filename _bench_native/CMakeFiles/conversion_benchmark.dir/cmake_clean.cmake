@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/conversion_benchmark.dir/benchmarks/conversion_benchmark.cpp.o"
+  "CMakeFiles/conversion_benchmark.dir/benchmarks/conversion_benchmark.cpp.o.d"
+  "conversion_benchmark"
+  "conversion_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/conversion_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
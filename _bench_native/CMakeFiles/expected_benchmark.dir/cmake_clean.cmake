@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/expected_benchmark.dir/benchmarks/expected_benchmark.cpp.o"
+  "CMakeFiles/expected_benchmark.dir/benchmarks/expected_benchmark.cpp.o.d"
+  "expected_benchmark"
+  "expected_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/expected_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
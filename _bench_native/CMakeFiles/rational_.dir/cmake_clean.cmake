@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "librational_.a"
+  "librational_.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/rational_.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simd_benchmark.dir/benchmarks/simd_benchmark.cpp.o"
+  "CMakeFiles/simd_benchmark.dir/benchmarks/simd_benchmark.cpp.o.d"
+  "simd_benchmark"
+  "simd_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simd_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sort_benchmark.dir/benchmarks/sort_benchmark.cpp.o"
+  "CMakeFiles/sort_benchmark.dir/benchmarks/sort_benchmark.cpp.o.d"
+  "sort_benchmark"
+  "sort_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sort_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
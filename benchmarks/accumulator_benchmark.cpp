@@ -0,0 +1,82 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+int main()
+{
+  constexpr std::size_t terms  = 1'000;
+  constexpr std::size_t chains = 1'000;
+
+  using rational    = std::experimental::rational<std::int64_t>;
+  using accumulator = std::experimental::rational_accumulator<std::int64_t>;
+
+  // Terms with small denominators (e.g. prices, probabilities of dice), the sums of which stay small.
+  std::mt19937_64                             generator(0);
+  std::uniform_int_distribution<std::int64_t> numerators  (-100, 100);
+  std::uniform_int_distribution<std::int64_t> denominators(1   , 12 );
+
+  std::vector<rational> values(terms * chains);
+  for (auto& value : values)
+    value = rational(numerators(generator), denominators(generator));
+
+  std::vector<rational> results(chains);
+  benchmark::measure("sum: rational::operator+="          , terms * chains, 5, [&]
+  {
+    for (std::size_t i = 0; i < chains; ++i)
+    {
+      rational sum;
+      for (std::size_t j = 0; j < terms; ++j)
+        sum += values[i * terms + j];
+      results[i] = sum;
+    }
+    benchmark::do_not_optimize(results.data());
+  });
+  benchmark::measure("sum: rational_accumulator::operator+=", terms * chains, 5, [&]
+  {
+    for (std::size_t i = 0; i < chains; ++i)
+    {
+      accumulator sum;
+      for (std::size_t j = 0; j < terms; ++j)
+        sum += values[i * terms + j];
+      results[i] = sum;
+    }
+    benchmark::do_not_optimize(results.data());
+  });
+
+  // Products of ratios and their inverses in pairs (e.g. exchange rates), the canonical result of which stays small.
+  std::uniform_int_distribution<std::int64_t> factors(1, 12);
+  for (std::size_t j = 0; j < terms; j += 2)
+  {
+    const auto lhs = factors(generator), rhs = factors(generator);
+    values[j    ] = rational(lhs, rhs);
+    values[j + 1] = rational(rhs, lhs);
+  }
+  benchmark::measure("product: rational::operator*="          , terms * chains, 5, [&]
+  {
+    for (std::size_t i = 0; i < chains; ++i)
+    {
+      rational product(1);
+      for (std::size_t j = 0; j < terms; ++j)
+        product *= values[j];
+      results[i] = product;
+    }
+    benchmark::do_not_optimize(results.data());
+  });
+  benchmark::measure("product: rational_accumulator::operator*=", terms * chains, 5, [&]
+  {
+    for (std::size_t i = 0; i < chains; ++i)
+    {
+      accumulator product(rational(1));
+      for (std::size_t j = 0; j < terms; ++j)
+        product *= values[j];
+      results[i] = product;
+    }
+    benchmark::do_not_optimize(results.data());
+  });
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+using pair = std::pair<std::int64_t, std::int64_t>;
+
+// Euclid's algorithm counting its iterations.
+std::int64_t counting_gcd(std::int64_t lhs, std::int64_t rhs, std::size_t& iterations)
+{
+  lhs = lhs < 0 ? -lhs : lhs;
+  rhs = rhs < 0 ? -rhs : rhs;
+  while (rhs != 0)
+  {
+    lhs = std::exchange(rhs, lhs % rhs);
+    ++iterations;
+  }
+  return lhs;
+}
+
+// The former operator+=: (ad + bc) / bd followed by a full canonicalization.
+pair naive_add   (const pair& lhs, const pair& rhs, std::size_t& iterations)
+{
+  const auto numerator   = lhs.first  * rhs.second + lhs.second * rhs.first;
+  const auto denominator = lhs.second * rhs.second;
+  const auto divisor     = counting_gcd(numerator, denominator, iterations);
+  return {numerator / divisor, denominator / divisor};
+}
+// Henrici's algorithm (Knuth TAOCP Vol. 2, 4.5.1).
+pair henrici_add (const pair& lhs, const pair& rhs, std::size_t& iterations)
+{
+  const auto divisor = counting_gcd(lhs.second, rhs.second, iterations);
+  if (divisor == 1)
+    return {lhs.first * rhs.second + lhs.second * rhs.first, lhs.second * rhs.second};
+  const auto t       = lhs.first * (rhs.second / divisor) + rhs.first * (lhs.second / divisor);
+  const auto reducer = counting_gcd(t, divisor, iterations);
+  return {t / reducer, (lhs.second / divisor) * (rhs.second / reducer)};
+}
+
+int main()
+{
+  constexpr std::size_t size = 1'000'000;
+
+  std::mt19937_64                             generator   (0);
+  std::uniform_int_distribution<std::int64_t> numerators  (-1'000'000, 1'000'000);
+  std::uniform_int_distribution<std::int64_t> denominators(         1, 1'000'000);
+
+  std::vector<std::experimental::rational<std::int64_t>> lhs, rhs;
+  lhs.reserve(size);
+  rhs.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    lhs.emplace_back(numerators(generator), denominators(generator));
+    rhs.emplace_back(numerators(generator), denominators(generator));
+  }
+
+  std::size_t naive_iterations  (0);
+  std::size_t henrici_iterations(0);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    naive_add  ({lhs[i].numerator(), lhs[i].denominator()}, {rhs[i].numerator(), rhs[i].denominator()}, naive_iterations  );
+    henrici_add({lhs[i].numerator(), lhs[i].denominator()}, {rhs[i].numerator(), rhs[i].denominator()}, henrici_iterations);
+  }
+  std::printf("gcd iterations per sum: naive %.2f, henrici %.2f\n", 
+    static_cast<double>(naive_iterations  ) / size, 
+    static_cast<double>(henrici_iterations) / size);
+
+  std::vector<pair> result(size);
+  benchmark::measure("naive   (ad + bc) / bd"   , size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      const auto numerator   = lhs[i].numerator  () * rhs[i].denominator() + lhs[i].denominator() * rhs[i].numerator();
+      const auto denominator = lhs[i].denominator() * rhs[i].denominator();
+      const auto divisor     = std::gcd(numerator, denominator);
+      result[i] = {numerator / divisor, denominator / divisor};
+    }
+    benchmark::do_not_optimize(result.data());
+  });
+
+  std::vector<std::experimental::rational<std::int64_t>> sums(size);
+  benchmark::measure("henrici rational::operator+=", size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      sums[i] = lhs[i] + rhs[i];
+    benchmark::do_not_optimize(sums.data());
+  });
+
+  return 0;
+}
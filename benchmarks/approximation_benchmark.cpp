@@ -0,0 +1,63 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+int main()
+{
+  constexpr std::size_t size = 1'000'000;
+
+  using rational = std::experimental::rational<std::int64_t, std::experimental::checked_saturate_policy>;
+
+  std::mt19937_64                        generator(0);
+  std::uniform_real_distribution<double> distribution(-100.0, 100.0);
+
+  std::vector<double> values(size);
+  for (auto& value : values)
+    value = distribution(generator);
+
+  std::vector<rational> rationals(size);
+  benchmark::measure("rational(double)"                  , size, 5, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      rationals[i] = rational(values[i]);
+    benchmark::do_not_optimize(rationals.data());
+  });
+  benchmark::measure("rational::approximate(double, 1000)", size, 5, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      rationals[i] = rational::approximate(values[i], 1000);
+    benchmark::do_not_optimize(rationals.data());
+  });
+  benchmark::measure("rational::approximate(double, 1e-5)", size, 5, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      rationals[i] = rational::approximate(values[i], 1e-5);
+    benchmark::do_not_optimize(rationals.data());
+  });
+
+  // Pairwise sums of the operands: Power of two denominators saturate, small denominators keep the gcds short.
+  std::vector<rational> exact(size), approximate(size), sums(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    exact      [i] = rational(values[i]);
+    approximate[i] = rational::approximate(values[i], 1000);
+  }
+  benchmark::measure("sum of rational(double)"            , size, 5, [&]
+  {
+    for (std::size_t i = 1; i < size; ++i)
+      sums[i] = exact[i - 1] + exact[i];
+    benchmark::do_not_optimize(sums.data());
+  });
+  benchmark::measure("sum of approximate(double, 1000)"   , size, 5, [&]
+  {
+    for (std::size_t i = 1; i < size; ++i)
+      sums[i] = approximate[i - 1] + approximate[i];
+    benchmark::do_not_optimize(sums.data());
+  });
+
+  return 0;
+}
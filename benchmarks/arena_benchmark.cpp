@@ -0,0 +1,91 @@
+#include "internal/benchmark.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include <std/experimental/rational_arena.hpp>
+
+// Counts the calls to the global allocation functions.
+static std::size_t allocations = 0;
+
+void* operator new   (const std::size_t size)
+{
+  ++allocations;
+  if (const auto pointer = std::malloc(size == 0 ? 1 : size))
+    return pointer;
+  throw std::bad_alloc();
+}
+void  operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+void  operator delete(void* pointer, std::size_t) noexcept
+{
+  std::free(pointer);
+}
+
+// Solves the Hilbert system H x = H 1 (whose solution is 1) by Gaussian elimination.
+template <typename type>
+type solve(const std::size_t size)
+{
+  std::vector<std::vector<type>> matrix(size, std::vector<type>(size + 1, type(0)));
+  for (std::size_t i = 0; i < size; ++i)
+    for (std::size_t j = 0; j < size; ++j)
+    {
+      matrix[i][j]     = type(1, static_cast<int>(i + j + 1));
+      matrix[i][size] += matrix[i][j];
+    }
+
+  for (std::size_t k = 0; k < size; ++k)
+    for (std::size_t i = k + 1; i < size; ++i)
+    {
+      const auto factor = matrix[i][k] / matrix[k][k];
+      for (std::size_t j = k; j <= size; ++j)
+        matrix[i][j] -= factor * matrix[k][j];
+    }
+
+  std::vector<type> solution(size, type(0));
+  for (std::size_t i = size; i-- > 0;)
+  {
+    auto sum = matrix[i][size];
+    for (std::size_t j = i + 1; j < size; ++j)
+      sum -= matrix[i][j] * solution[j];
+    solution[i] = sum / matrix[i][i];
+  }
+  return solution.front();
+}
+
+template <typename function_type>
+void run(const char* name, const std::size_t size, const std::size_t solves, function_type&& function)
+{
+  const auto start = allocations;
+  benchmark::measure(name, solves, 1, [&]
+  {
+    for (std::size_t i = 0; i < solves; ++i)
+      function(size);
+  });
+  std::printf("%-48s %12zu allocations/solve\n", "", (allocations - start) / solves);
+}
+
+int main()
+{
+  constexpr std::size_t size   = 12;
+  constexpr std::size_t solves = 200;
+
+  run("rational<big_integer>"                  , size, solves, [ ] (const std::size_t size)
+  {
+    benchmark::do_not_optimize(solve<std::experimental::rational<std::experimental::big_integer>>(size));
+  });
+  // One arena for the batch, reset after each solve.
+  std::experimental::rational_arena arena(1 << 20);
+  run("pmr::rational<> (rational_arena, reset)", size, solves, [&] (const std::size_t size)
+  {
+    benchmark::do_not_optimize(std::experimental::big_integer(solve<std::experimental::pmr::rational<>>(size).numerator()));
+    arena.reset();
+  });
+
+  return 0;
+}
@@ -0,0 +1,25 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <string>
+
+#include <std/experimental/big_integer.hpp>
+
+// Compare with benchmarks/harmonic_benchmark.py, the same workload on Python's fractions.Fraction.
+int main()
+{
+  using rational = std::experimental::rational<std::experimental::big_integer>;
+
+  for (const auto terms : {100, 1000, 5000})
+  {
+    benchmark::measure("harmonic number H(" + std::to_string(terms) + "): rational<big_integer>", static_cast<std::size_t>(terms), 3, [&]
+    {
+      rational sum;
+      for (auto i = 1; i <= terms; ++i)
+        sum += rational(1, i);
+      benchmark::do_not_optimize(sum);
+    });
+  }
+
+  return 0;
+}
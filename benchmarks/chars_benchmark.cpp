@@ -0,0 +1,73 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+int main()
+{
+  constexpr std::size_t size = 1'000'000;
+
+  using rational = std::experimental::rational<std::int64_t>;
+
+  std::mt19937_64                             generator(0);
+  std::uniform_int_distribution<std::int64_t> distribution(-1'000'000'000, 1'000'000'000);
+
+  std::vector<rational> rationals(size);
+  for (auto& value : rationals)
+    value = rational(distribution(generator), distribution(generator) / 2 + 1'000'000'001);
+
+  // One rational per line, as in a single column CSV file.
+  std::string text;
+  {
+    std::ostringstream stream;
+    for (const auto& value : rationals)
+      stream << value << '\n';
+    text = stream.str();
+  }
+  const auto megabytes = static_cast<double>(text.size()) / 1e6;
+  const auto report    = [&] (const double seconds) { std::printf("%-48s %12.1f MB/s\n", "", megabytes / seconds); };
+
+  std::vector<rational> parsed(size);
+  report(benchmark::measure("operator>>"                , size, 5, [&]
+  {
+    std::istringstream stream(text);
+    for (auto& value : parsed)
+      stream >> value;
+    benchmark::do_not_optimize(parsed.data());
+  }));
+  report(benchmark::measure("from_chars"                , size, 5, [&]
+  {
+    const char* current = text.data();
+    for (auto& value : parsed)
+      current = from_chars(current, text.data() + text.size(), value).ptr + 1;
+    benchmark::do_not_optimize(parsed.data());
+  }));
+
+  std::string written(text.size(), '\0');
+  report(benchmark::measure("operator<<"                , size, 5, [&]
+  {
+    std::ostringstream stream;
+    for (const auto& value : rationals)
+      stream << value << '\n';
+    written = stream.str();
+    benchmark::do_not_optimize(written.data());
+  }));
+  report(benchmark::measure("to_chars"                  , size, 5, [&]
+  {
+    auto current = written.data();
+    for (const auto& value : rationals)
+    {
+      current    = to_chars(current, written.data() + written.size(), value).ptr;
+      *current++ = '\n';
+    }
+    benchmark::do_not_optimize(written.data());
+  }));
+
+  return 0;
+}
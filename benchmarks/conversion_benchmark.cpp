@@ -0,0 +1,73 @@
+#include "internal/benchmark.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+// The former conversion through std::isfinite, std::frexp and std::exp2, followed by a full canonicalization.
+std::pair<std::int64_t, std::int64_t> frexp_assign(const double value)
+{
+  constexpr auto mantissa = std::numeric_limits<double>::digits;
+
+  if (!std::isfinite(value))
+    throw std::domain_error("Value can not be infinite.");
+
+  auto exponent    = 0;
+  auto numerator   = static_cast<std::int64_t>(std::frexp(value, &exponent) * std::exp2(mantissa));
+  auto denominator = std::int64_t(1);
+  exponent -= mantissa;
+  if      (exponent > 0)
+    numerator   *= static_cast<std::int64_t>(std::exp2( exponent));
+  else if (exponent < 0)
+    denominator *= static_cast<std::int64_t>(std::exp2(-exponent));
+
+  const auto gcd = std::gcd(numerator, denominator);
+  return {numerator / gcd, denominator / gcd};
+}
+
+int main()
+{
+  constexpr std::size_t size = 10'000'000;
+
+  // Doubles with up to 53 significant bits and small exponents, which convert exactly to 64-bit rationals.
+  std::mt19937_64                             generator(0);
+  std::uniform_int_distribution<std::int64_t> mantissas(-(std::int64_t(1) << 53), std::int64_t(1) << 53);
+  std::uniform_int_distribution<int>          exponents(-9, 9);
+
+  std::vector<double> values(size);
+  for (auto& value : values)
+    value = std::ldexp(static_cast<double>(mantissas(generator)), exponents(generator));
+
+  std::vector<std::pair<std::int64_t, std::int64_t>> pairs(size);
+  benchmark::measure("frexp/exp2 + gcd"             , size, 5, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      pairs[i] = frexp_assign(values[i]);
+    benchmark::do_not_optimize(pairs.data());
+  });
+
+  std::vector<std::experimental::rational<std::int64_t>> rationals(size);
+  benchmark::measure("bit-level rational(double)"  , size, 5, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      rationals[i] = std::experimental::rational<std::int64_t>(values[i]);
+    benchmark::do_not_optimize(rationals.data());
+  });
+
+#if defined(__cpp_lib_expected)
+  benchmark::measure("bit-level rational::make(double)", size, 5, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      rationals[i] = std::experimental::rational<std::int64_t>::make(values[i]).value_or(0);
+    benchmark::do_not_optimize(rationals.data());
+  });
+#endif
+
+  return 0;
+}
@@ -0,0 +1,51 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <std/experimental/dynamic_rational.hpp>
+
+template <typename type>
+void run(const char* name, const std::vector<std::int64_t>& numerators, const std::vector<std::int64_t>& denominators, const std::size_t chain)
+{
+  std::vector<type> values;
+  for (std::size_t i = 0; i < numerators.size(); ++i)
+    values.emplace_back(type(numerators[i]) / type(denominators[i]));
+
+  // Typical data: Short chains of sums of values with small denominators (which fit 64 bits), and their products with a value.
+  benchmark::measure(name, values.size(), 3, [&]
+  {
+    for (std::size_t i = 0; i + chain <= values.size(); i += chain)
+    {
+      type sum(0);
+      for (std::size_t j = i; j < i + chain; ++j)
+        sum += values[j];
+      sum *= values[i];
+      benchmark::do_not_optimize(sum);
+    }
+  });
+}
+
+int main()
+{
+  constexpr std::size_t size  = 1 << 20;
+  constexpr std::size_t chain = 16;
+
+  std::mt19937_64                             generator(0);
+  std::uniform_int_distribution<std::int64_t> numerator_distribution  (-1000, 1000);
+  std::uniform_int_distribution<std::int64_t> denominator_distribution(1    , 20  );
+
+  std::vector<std::int64_t> numerators(size), denominators(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    numerators  [i] = numerator_distribution  (generator);
+    denominators[i] = denominator_distribution(generator);
+  }
+
+  run<std::experimental::rational<std::int64_t>>                     ("rational<std::int64_t>" , numerators, denominators, chain);
+  run<std::experimental::dynamic_rational>                           ("dynamic_rational"       , numerators, denominators, chain);
+  run<std::experimental::rational<std::experimental::big_integer>>   ("rational<big_integer>"  , numerators, denominators, chain);
+
+  return 0;
+}
@@ -0,0 +1,50 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+int main()
+{
+  constexpr std::size_t size = 10'000'000;
+
+  using rational = std::experimental::rational<std::int64_t>;
+
+  // Small operands take the hardware division path, large ones need the extended one.
+  for (const auto bits : {32, 62})
+  {
+    std::mt19937_64                             generator(0);
+    std::uniform_int_distribution<std::int64_t> distribution(1, (std::int64_t(1) << bits) - 1);
+
+    std::vector<rational> rationals(size);
+    for (auto& value : rationals)
+      value = rational(distribution(generator), distribution(generator));
+
+    std::vector<double> results(size);
+    const auto suffix = " (" + std::to_string(bits) + "-bit)";
+    benchmark::measure("double(n) / double(d)"        + suffix, size, 5, [&]
+    {
+      for (std::size_t i = 0; i < size; ++i)
+        results[i] = static_cast<double>(rationals[i].numerator()) / static_cast<double>(rationals[i].denominator());
+      benchmark::do_not_optimize(results.data());
+    });
+    benchmark::measure("evaluate<double>()"           + suffix, size, 5, [&]
+    {
+      for (std::size_t i = 0; i < size; ++i)
+        results[i] = rationals[i].evaluate<double>();
+      benchmark::do_not_optimize(results.data());
+    });
+    benchmark::measure("to_double(round_toward_zero)" + suffix, size, 5, [&]
+    {
+      for (std::size_t i = 0; i < size; ++i)
+        results[i] = rationals[i].to_double(std::round_toward_zero);
+      benchmark::do_not_optimize(results.data());
+    });
+  }
+
+  return 0;
+}
@@ -0,0 +1,61 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+int main()
+{
+#if defined(__cpp_lib_expected)
+  using rational = std::experimental::rational<std::int64_t>;
+
+  constexpr std::size_t size = 1'000'000;
+
+  std::mt19937_64                             generator   (0);
+  std::uniform_int_distribution<std::int64_t> numerators  (-1000, 1000);
+  std::uniform_int_distribution<std::int64_t> denominators(    1, 1000);
+
+  std::vector<std::int64_t> lhs(size), rhs(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    lhs[i] = numerators  (generator);
+    rhs[i] = denominators(generator);
+  }
+
+  std::vector<rational> result(size);
+  benchmark::measure("throwing  rational(n, d)"       , size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      result[i] = rational(lhs[i], rhs[i]);
+    benchmark::do_not_optimize(result.data());
+  });
+  benchmark::measure("expected  rational::make(n, d)" , size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      result[i] = rational::make(lhs[i], rhs[i]).value_or(rational());
+    benchmark::do_not_optimize(result.data());
+  });
+
+  std::vector<rational> values(size);
+  for (std::size_t i = 0; i < size; ++i)
+    values[i] = rational(lhs[i] == 0 ? 1 : lhs[i], rhs[i]);
+
+  benchmark::measure("throwing  a / b"                , size, 10, [&]
+  {
+    for (std::size_t i = 0; i + 1 < size; ++i)
+      result[i] = values[i] / values[i + 1];
+    benchmark::do_not_optimize(result.data());
+  });
+  benchmark::measure("expected  a.try_divide(b)"      , size, 10, [&]
+  {
+    for (std::size_t i = 0; i + 1 < size; ++i)
+      result[i] = values[i].try_divide(values[i + 1]).value_or(rational());
+    benchmark::do_not_optimize(result.data());
+  });
+#else
+  std::printf("std::expected is not available.\n");
+#endif
+  return 0;
+}
@@ -0,0 +1,87 @@
+#define RATIONAL_EXPRESSION_TEMPLATES
+
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+using rational = std::experimental::rational<std::int64_t>;
+
+// The evaluation operation by operation, as the operators without expression templates (a copy and a compound assignment each).
+rational eager_polynomial(const rational* c, const rational& x)
+{
+  rational result = c[4];
+  result *= x; result += c[3];
+  result *= x; result += c[2];
+  result *= x; result += c[1];
+  result *= x; result += c[0];
+  return result;
+}
+rational eager_dot       (const rational* a, const rational* b)
+{
+  rational result = a[0], term;
+  result *= b[0];
+  term = a[1]; term *= b[1]; result += term;
+  term = a[2]; term *= b[2]; result += term;
+  term = a[3]; term *= b[3]; result += term;
+  return result;
+}
+
+// The same expressions, fused and canonized once.
+rational fused_polynomial(const rational* c, const rational& x)
+{
+  return (((c[4] * x + c[3]) * x + c[2]) * x + c[1]) * x + c[0];
+}
+rational fused_dot       (const rational* a, const rational* b)
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+}
+
+int main()
+{
+  constexpr std::size_t size = 1 << 20;
+
+  std::mt19937_64                             generator(0);
+  std::uniform_int_distribution<std::int64_t> numerators  (-1000, 1000);
+  std::uniform_int_distribution<std::int64_t> denominators(1    , 20  );
+
+  std::vector<rational> lhs, rhs, results(size / 4);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    lhs.emplace_back(numerators(generator), denominators(generator));
+    rhs.emplace_back(numerators(generator), denominators(generator));
+  }
+
+  // Degree 4 polynomials (Horner) of the coefficients lhs[4i, 4i + 5) at rhs[4i].
+  benchmark::measure("polynomial (operation by operation)", size / 4, 5, [&]
+  {
+    for (std::size_t i = 0; i + 5 <= size; i += 4)
+      results[i / 4] = eager_polynomial(&lhs[i], rhs[i]);
+    benchmark::do_not_optimize(results.data());
+  });
+  benchmark::measure("polynomial (expression templates)"  , size / 4, 5, [&]
+  {
+    for (std::size_t i = 0; i + 5 <= size; i += 4)
+      results[i / 4] = fused_polynomial(&lhs[i], rhs[i]);
+    benchmark::do_not_optimize(results.data());
+  });
+
+  // Dot products of length 4.
+  benchmark::measure("dot product (operation by operation)", size / 4, 5, [&]
+  {
+    for (std::size_t i = 0; i < size; i += 4)
+      results[i / 4] = eager_dot(&lhs[i], &rhs[i]);
+    benchmark::do_not_optimize(results.data());
+  });
+  benchmark::measure("dot product (expression templates)"  , size / 4, 5, [&]
+  {
+    for (std::size_t i = 0; i < size; i += 4)
+      results[i / 4] = fused_dot(&lhs[i], &rhs[i]);
+    benchmark::do_not_optimize(results.data());
+  });
+
+  return 0;
+}
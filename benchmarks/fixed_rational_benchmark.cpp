@@ -0,0 +1,48 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <std/experimental/fixed_rational.hpp>
+
+int main()
+{
+  constexpr std::size_t size = 1 << 20;
+
+  using rational = std::experimental::rational<std::int64_t>;
+  using ticks    = std::experimental::fixed_rational<std::int64_t, 90000>;
+
+  // Durations of a 90 kHz timebase (e.g. video presentation timestamps), accumulated and scaled by a repetition count.
+  std::mt19937_64                             generator(0);
+  std::uniform_int_distribution<std::int64_t> durations(1, 6000);
+  std::uniform_int_distribution<std::int64_t> counts   (1, 4   );
+
+  std::vector<rational>     rationals;
+  std::vector<ticks>        fixed    ;
+  std::vector<std::int64_t> repeats  ;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const auto duration = durations(generator);
+    rationals.emplace_back(duration, 90000);
+    fixed    .emplace_back(duration);
+    repeats  .emplace_back(counts(generator));
+  }
+
+  benchmark::measure("rational<std::int64_t>"            , size, 10, [&]
+  {
+    rational timestamp;
+    for (std::size_t i = 0; i < size; ++i)
+      timestamp += rationals[i] * repeats[i];
+    benchmark::do_not_optimize(timestamp);
+  });
+  benchmark::measure("fixed_rational<std::int64_t, 90000>", size, 10, [&]
+  {
+    ticks timestamp;
+    for (std::size_t i = 0; i < size; ++i)
+      timestamp += fixed[i] * repeats[i];
+    benchmark::do_not_optimize(timestamp);
+  });
+
+  return 0;
+}
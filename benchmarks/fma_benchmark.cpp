@@ -0,0 +1,76 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+int main()
+{
+  constexpr std::size_t terms  = 100;
+  constexpr std::size_t chains = 10'000;
+
+  using rational    = std::experimental::rational<std::int64_t>;
+  using accumulator = std::experimental::rational_accumulator<std::int64_t>;
+
+  // Weighted sums of values and weights with small denominators, which stay small.
+  std::mt19937_64                             generator(0);
+  std::uniform_int_distribution<std::int64_t> numerators  (-100, 100);
+  std::uniform_int_distribution<std::int64_t> denominators(1   , 12 );
+
+  std::vector<rational> values(terms * chains), weights(terms * chains);
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    values [i] = rational(numerators(generator), denominators(generator));
+    weights[i] = rational(numerators(generator), denominators(generator));
+  }
+
+  std::vector<rational> results(chains);
+  benchmark::measure("rational: acc += x * w"              , terms * chains, 5, [&]
+  {
+    for (std::size_t i = 0; i < chains; ++i)
+    {
+      rational sum;
+      for (std::size_t j = i * terms; j < (i + 1) * terms; ++j)
+        sum += values[j] * weights[j];
+      results[i] = sum;
+    }
+    benchmark::do_not_optimize(results.data());
+  });
+  benchmark::measure("rational: acc.fma_assign(x, w)"      , terms * chains, 5, [&]
+  {
+    for (std::size_t i = 0; i < chains; ++i)
+    {
+      rational sum;
+      for (std::size_t j = i * terms; j < (i + 1) * terms; ++j)
+        sum.fma_assign(values[j], weights[j]);
+      results[i] = sum;
+    }
+    benchmark::do_not_optimize(results.data());
+  });
+  benchmark::measure("rational_accumulator: acc += x * w"        , terms * chains, 5, [&]
+  {
+    for (std::size_t i = 0; i < chains; ++i)
+    {
+      accumulator sum;
+      for (std::size_t j = i * terms; j < (i + 1) * terms; ++j)
+        sum += values[j] * weights[j];
+      results[i] = sum;
+    }
+    benchmark::do_not_optimize(results.data());
+  });
+  benchmark::measure("rational_accumulator: acc.fma_assign(x, w)", terms * chains, 5, [&]
+  {
+    for (std::size_t i = 0; i < chains; ++i)
+    {
+      accumulator sum;
+      for (std::size_t j = i * terms; j < (i + 1) * terms; ++j)
+        sum.fma_assign(values[j], weights[j]);
+      results[i] = sum;
+    }
+    benchmark::do_not_optimize(results.data());
+  });
+
+  return 0;
+}
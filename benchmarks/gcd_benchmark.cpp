@@ -0,0 +1,77 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+template <typename type>
+void run(const std::string& name, std::mt19937_64& generator)
+{
+  constexpr std::size_t size = 1'000'000;
+
+  // Operands share a random common factor, as the numerators and denominators of unreduced rationals do.
+  std::vector<type> lhs(size), rhs(size), result(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const auto factor = static_cast<type>(generator() % 1024 + 1);
+    // Random bits of the full width (truncated to the narrower types).
+    type a, b;
+    if constexpr (sizeof(type) > sizeof(std::uint64_t))
+    {
+      a = static_cast<type>(static_cast<type>(generator()) << 64 | static_cast<type>(generator()));
+      b = static_cast<type>(static_cast<type>(generator()) << 64 | static_cast<type>(generator()));
+    }
+    else
+    {
+      a = static_cast<type>(generator());
+      b = static_cast<type>(generator());
+    }
+    lhs[i] = static_cast<type>((a >> 10) * factor);
+    rhs[i] = static_cast<type>((b >> 10) * factor);
+  }
+
+  benchmark::measure(name + " std::gcd"   , size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      result[i] = std::gcd(lhs[i], rhs[i]);
+    benchmark::do_not_optimize(result.data());
+  });
+  benchmark::measure(name + " binary_gcd" , size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      result[i] = std::experimental::detail::binary_gcd(lhs[i], rhs[i]);
+    benchmark::do_not_optimize(result.data());
+  });
+  benchmark::measure(name + " hybrid_gcd" , size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      result[i] = std::experimental::detail::hybrid_gcd(lhs[i], rhs[i]);
+    benchmark::do_not_optimize(result.data());
+  });
+  if constexpr (sizeof(type) > sizeof(std::uint64_t))
+    benchmark::measure(name + " lehmer_gcd" , size, 10, [&]
+    {
+      for (std::size_t i = 0; i < size; ++i)
+        result[i] = std::experimental::detail::lehmer_gcd(lhs[i], rhs[i]);
+      benchmark::do_not_optimize(result.data());
+    });
+  benchmark::measure(name + " detail::gcd", size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      result[i] = std::experimental::detail::gcd(lhs[i], rhs[i]);
+    benchmark::do_not_optimize(result.data());
+  });
+}
+
+int main()
+{
+  std::mt19937_64 generator(0);
+  run<std::uint32_t>     ("32-bit" , generator);
+  run<std::uint64_t>     ("64-bit" , generator);
+  run<unsigned __int128> ("128-bit", generator);
+  return 0;
+}
@@ -0,0 +1,14 @@
+# The harmonic number workload of big_integer_benchmark.cpp on Python's fractions.Fraction, for comparison.
+import time
+from fractions import Fraction
+
+for terms in (100, 1000, 5000):
+    iterations = 3
+    start = time.perf_counter()
+    for _ in range(iterations):
+        total = Fraction(0)
+        for i in range(1, terms + 1):
+            total += Fraction(1, i)
+    seconds = (time.perf_counter() - start) / iterations
+    name = "harmonic number H(%d): fractions.Fraction" % terms
+    print("%-48s %12.3f ms %16.0f elements/s" % (name, seconds * 1e3, terms / seconds))
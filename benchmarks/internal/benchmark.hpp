@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string_view>
+
+namespace benchmark
+{
+// Prevents the compiler from optimizing away the computation of the given value.
+template <typename type>
+void   do_not_optimize(const type& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+// Runs the function the given number of times and reports the average time per iteration and the throughput in elements per second.
+template <typename function_type>
+double measure        (const std::string_view name, const std::size_t elements, const std::size_t iterations, function_type&& function)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < iterations; ++i)
+    function();
+  const auto end   = std::chrono::steady_clock::now();
+
+  const auto seconds = std::chrono::duration<double>(end - start).count() / static_cast<double>(iterations);
+  std::printf("%-48.*s %12.3f ms %16.0f elements/s\n", static_cast<int>(name.size()), name.data(), seconds * 1e3, static_cast<double>(elements) / seconds);
+  return seconds;
+}
+}
@@ -0,0 +1,71 @@
+#include "internal/benchmark.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+// Reproduces the former layout of the rational (a virtual destructor adding a vptr) as a baseline.
+struct polymorphic_rational
+{
+  constexpr polymorphic_rational         (const std::int32_t numerator = 0, const std::int32_t denominator = 1) : numerator(numerator), denominator(denominator) { }
+  constexpr polymorphic_rational         (const polymorphic_rational&  that) = default;
+  constexpr polymorphic_rational         (      polymorphic_rational&& temp) = default;
+  constexpr virtual ~polymorphic_rational()                                  = default;
+  constexpr polymorphic_rational& operator=(const polymorphic_rational&  that) = default;
+  constexpr polymorphic_rational& operator=(      polymorphic_rational&& temp) = default;
+
+  constexpr bool operator< (const polymorphic_rational& that) const
+  {
+    return static_cast<std::int64_t>(numerator) * that.denominator < static_cast<std::int64_t>(denominator) * that.numerator;
+  }
+
+  std::int32_t numerator  ;
+  std::int32_t denominator;
+};
+
+template <typename type>
+void run(const char* name, const std::vector<std::pair<std::int32_t, std::int32_t>>& source)
+{
+  std::vector<type> values;
+  values.reserve(source.size());
+  for (const auto& [numerator, denominator] : source)
+    values.emplace_back(numerator, denominator);
+
+  std::printf("%s: sizeof = %zu\n", name, sizeof(type));
+
+  std::vector<type> copy(values.size());
+  benchmark::measure(std::string(name) + " copy", values.size(), 20, [&]
+  {
+    std::copy(values.begin(), values.end(), copy.begin());
+    benchmark::do_not_optimize(copy.data());
+  });
+  benchmark::measure(std::string(name) + " sort", values.size(), 3 , [&]
+  {
+    copy = values;
+    std::sort(copy.begin(), copy.end());
+    benchmark::do_not_optimize(copy.data());
+  });
+}
+
+int main()
+{
+  constexpr std::size_t size = 10'000'000;
+
+  std::mt19937                                 generator   (0);
+  std::uniform_int_distribution<std::int32_t>  numerators  (-1000, 1000);
+  std::uniform_int_distribution<std::int32_t>  denominators(    1, 1000);
+
+  std::vector<std::pair<std::int32_t, std::int32_t>> source(size);
+  for (auto& [numerator, denominator] : source)
+    numerator = numerators(generator), denominator = denominators(generator);
+
+  run<polymorphic_rational>                     ("polymorphic_rational"       , source);
+  run<std::experimental::rational<std::int32_t>>("rational<std::int32_t>"     , source);
+
+  return 0;
+}
@@ -0,0 +1,56 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+template <typename type, typename policy>
+void run(const std::string& name)
+{
+  using rational = std::experimental::rational<type, policy>;
+
+  constexpr std::size_t size = 1'000'000;
+
+  std::mt19937_64                     generator   (0);
+  std::uniform_int_distribution<type> numerators  (-1000, 1000);
+  std::uniform_int_distribution<type> denominators(    1, 1000);
+
+  std::vector<rational> lhs, rhs, result(size);
+  lhs.reserve(size);
+  rhs.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    lhs.emplace_back(numerators(generator), denominators(generator));
+    rhs.emplace_back(numerators(generator), denominators(generator));
+  }
+
+  benchmark::measure(name + " a + b", size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      result[i] = lhs[i] + rhs[i];
+    benchmark::do_not_optimize(result.data());
+  });
+  benchmark::measure(name + " a * b", size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      result[i] = lhs[i] * rhs[i];
+    benchmark::do_not_optimize(result.data());
+  });
+}
+
+int main()
+{
+  using namespace std::experimental;
+  run<std::int32_t, unchecked_policy       >("int32_t unchecked_policy       ");
+  run<std::int32_t, checked_throw_policy   >("int32_t checked_throw_policy   ");
+  run<std::int32_t, checked_saturate_policy>("int32_t checked_saturate_policy");
+  run<std::int32_t, promote_policy         >("int32_t promote_policy         ");
+  run<std::int64_t, unchecked_policy       >("int64_t unchecked_policy       ");
+  run<std::int64_t, checked_throw_policy   >("int64_t checked_throw_policy   ");
+  run<std::int64_t, checked_saturate_policy>("int64_t checked_saturate_policy");
+  run<std::int64_t, promote_policy         >("int64_t promote_policy         ");
+  return 0;
+}
@@ -0,0 +1,54 @@
+#include "internal/benchmark.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if __has_include(<oneapi/tbb/global_control.h>)
+#include <oneapi/tbb/global_control.h>
+#endif
+
+#include <std/experimental/rational_numeric.hpp>
+
+int main()
+{
+  constexpr std::size_t size = 1 << 22;
+
+  using rational = std::experimental::rational<std::int64_t>;
+
+  std::mt19937_64                             generator(0);
+  std::uniform_int_distribution<std::int64_t> numerators  (-100, 100);
+  std::uniform_int_distribution<std::int64_t> denominators(1   , 12 );
+
+  std::vector<rational> lhs(size), rhs(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    lhs[i] = rational(numerators(generator), denominators(generator));
+    rhs[i] = rational(numerators(generator), denominators(generator));
+  }
+
+  benchmark::measure("sum: std::accumulate"                , size, 3, [&] { benchmark::do_not_optimize(std::accumulate   (lhs.begin(), lhs.end(), rational())); });
+  benchmark::measure("sum: rational_sum (seq)"             , size, 3, [&] { benchmark::do_not_optimize(std::experimental::rational_sum(lhs.begin(), lhs.end())); });
+  benchmark::measure("dot: std::inner_product"             , size, 3, [&] { benchmark::do_not_optimize(std::inner_product(lhs.begin(), lhs.end(), rhs.begin(), rational())); });
+  benchmark::measure("dot: rational_dot (seq)"             , size, 3, [&] { benchmark::do_not_optimize(std::experimental::rational_dot(lhs.begin(), lhs.end(), rhs.begin())); });
+
+  // Scaling of the parallel policy from 1 to N threads in powers of two, ending at N (the number of threads is limited through TBB, 
+  // where available).
+  const auto maximum_threads = std::max(std::thread::hardware_concurrency(), 1u);
+  for (unsigned threads = 1, previous = 0; threads != previous; previous = threads, threads = std::min(threads * 2, maximum_threads))
+  {
+#if __has_include(<oneapi/tbb/global_control.h>)
+    const oneapi::tbb::global_control control(oneapi::tbb::global_control::max_allowed_parallelism, threads);
+#endif
+    const auto suffix = " (par, " + std::to_string(threads) + " threads)";
+    benchmark::measure("sum: rational_sum" + suffix, size, 3, [&] { benchmark::do_not_optimize(std::experimental::rational_sum(std::execution::par, lhs.begin(), lhs.end())); });
+    benchmark::measure("dot: rational_dot" + suffix, size, 3, [&] { benchmark::do_not_optimize(std::experimental::rational_dot(std::execution::par, lhs.begin(), lhs.end(), rhs.begin())); });
+  }
+
+  return 0;
+}
@@ -0,0 +1,91 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <std/experimental/rational_simd.hpp>
+
+// Build with -march=native (or -mavx2, -mavx512f) to enable the wider instruction sets.
+template <typename isa>
+void measure_batch(const std::string& name, const std::experimental::rational_span<std::int32_t>& result, const std::experimental::rational_span<const std::int32_t>& lhs, const std::experimental::rational_span<const std::int32_t>& rhs, std::vector<std::int32_t>& ordering)
+{
+  benchmark::measure("add "      + name, result.size(), 10, [&]
+  {
+    std::experimental::detail::simd::add     <isa>(result, lhs, rhs, false);
+    benchmark::do_not_optimize(result.numerators.data());
+  });
+  benchmark::measure("multiply " + name, result.size(), 10, [&]
+  {
+    std::experimental::detail::simd::multiply<isa>(result, lhs, rhs);
+    benchmark::do_not_optimize(result.numerators.data());
+  });
+  benchmark::measure("compare "  + name, result.size(), 10, [&]
+  {
+    std::experimental::detail::simd::compare <isa>(ordering, lhs, rhs);
+    benchmark::do_not_optimize(ordering.data());
+  });
+}
+
+int main()
+{
+  constexpr std::size_t size = 1'000'000;
+
+  using rational = std::experimental::rational<std::int32_t>;
+
+  std::mt19937                                generator(0);
+  std::uniform_int_distribution<std::int32_t> distribution(1, 1'000'000);
+
+  std::vector<rational>     lhs(size), rhs(size), sums(size);
+  std::vector<std::int32_t> a(size), b(size), c(size), d(size), n(size), m(size), ordering(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    lhs[i] = rational(distribution(generator), distribution(generator));
+    rhs[i] = rational(distribution(generator), distribution(generator));
+    a[i] = lhs[i].numerator(); b[i] = lhs[i].denominator();
+    c[i] = rhs[i].numerator(); d[i] = rhs[i].denominator();
+  }
+
+  // The canonical results exceed 32 bits in general, rational<std::int64_t> matches the exact 64-bit intermediates of the batch.
+  std::vector<std::experimental::rational<std::int64_t>> wide_lhs(size), wide_rhs(size), wide_sums(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    wide_lhs[i] = std::experimental::rational<std::int64_t>(a[i], b[i]);
+    wide_rhs[i] = std::experimental::rational<std::int64_t>(c[i], d[i]);
+  }
+  benchmark::measure("add rational<int64_t> (array of structures)"     , size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      wide_sums[i] = wide_lhs[i] + wide_rhs[i];
+    benchmark::do_not_optimize(wide_sums.data());
+  });
+  benchmark::measure("multiply rational<int64_t> (array of structures)", size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      wide_sums[i] = wide_lhs[i] * wide_rhs[i];
+    benchmark::do_not_optimize(wide_sums.data());
+  });
+  benchmark::measure("compare rational<int32_t> (array of structures)" , size, 10, [&]
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      ordering[i] = lhs[i] < rhs[i] ? -1 : lhs[i] > rhs[i] ? 1 : 0;
+    benchmark::do_not_optimize(ordering.data());
+  });
+
+  const std::experimental::rational_span<const std::int32_t> lhs_span {a, b}, rhs_span {c, d};
+  const std::experimental::rational_span<std::int32_t>       result   {n, m};
+  measure_batch<std::experimental::detail::simd::scalar>("batch (scalar)"     , result, lhs_span, rhs_span, ordering);
+#if defined(__SSE2__) || defined(_M_X64)
+  measure_batch<std::experimental::detail::simd::sse2  >("batch (SSE2)"       , result, lhs_span, rhs_span, ordering);
+#endif
+#if defined(__AVX2__)
+  measure_batch<std::experimental::detail::simd::avx2  >("batch (AVX2)"       , result, lhs_span, rhs_span, ordering);
+#endif
+#if defined(__AVX512F__)
+  measure_batch<std::experimental::detail::simd::avx512>("batch (AVX-512)"    , result, lhs_span, rhs_span, ordering);
+#endif
+  measure_batch<std::experimental::detail::simd::native>("batch (native, x4)" , result, lhs_span, rhs_span, ordering);
+
+  return 0;
+}
@@ -0,0 +1,82 @@
+#include "internal/benchmark.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+template <typename type>
+void run(const std::string& name, const std::size_t size, const type limit, const type timebase = 0)
+{
+  using rational = std::experimental::rational<type>;
+
+  std::mt19937_64                     generator   (0);
+  std::uniform_int_distribution<type> numerators  (-limit, limit);
+  std::uniform_int_distribution<type> denominators(     1, limit);
+
+  std::vector<rational> values;
+  values.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+    values.emplace_back(numerators(generator), timebase != 0 ? timebase : denominators(generator));
+
+  std::vector<rational> sorted;
+  benchmark::measure(name + " sort cross-multiplication", size, 1, [&]
+  {
+    sorted = values;
+    std::sort(sorted.begin(), sorted.end(), [ ] (const rational& lhs, const rational& rhs)
+    {
+      return lhs.numerator() * rhs.denominator() < lhs.denominator() * rhs.numerator();
+    });
+    benchmark::do_not_optimize(sorted.data());
+  });
+  std::printf("%s cross-multiplication result is %s\n", name.c_str(), std::is_sorted(sorted.begin(), sorted.end()) ? "sorted" : "NOT sorted (overflow)");
+
+  // The former two-pass comparison: an equality test followed by the ordering.
+  const auto two_pass = [ ] (const rational& lhs, const rational& rhs)
+  {
+    if (lhs == rhs)
+      return false;
+    return std::experimental::detail::compare_fractions(lhs.numerator(), lhs.denominator(), rhs.numerator(), rhs.denominator()) < 0;
+  };
+
+  benchmark::measure(name + " sort two-pass"            , size, 1, [&]
+  {
+    sorted = values;
+    std::sort(sorted.begin(), sorted.end(), two_pass);
+    benchmark::do_not_optimize(sorted.data());
+  });
+  benchmark::measure(name + " sort operator<=>"         , size, 1, [&]
+  {
+    sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    benchmark::do_not_optimize(sorted.data());
+  });
+
+  std::size_t found(0);
+  benchmark::measure(name + " lower_bound two-pass"     , size, 1, [&]
+  {
+    for (const auto& value : values)
+      found += std::lower_bound(sorted.begin(), sorted.end(), value, two_pass) - sorted.begin();
+    benchmark::do_not_optimize(found);
+  });
+  benchmark::measure(name + " lower_bound operator<=>"  , size, 1, [&]
+  {
+    for (const auto& value : values)
+      found += std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin();
+    benchmark::do_not_optimize(found);
+  });
+}
+
+int main(int argc, char** argv)
+{
+  const std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+
+  run<std::int64_t>("int64_t small", size, std::int64_t(1) << 20);
+  run<std::int64_t>("int64_t large", size, std::int64_t(1) << 60);
+  run<__int128>    ("int128 timebase", size, std::int64_t(1) << 40, 65537); // A prime timebase keeps the denominators equal.
+  return 0;
+}
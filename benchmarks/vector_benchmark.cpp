@@ -0,0 +1,66 @@
+#include "internal/benchmark.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <std/experimental/rational_vector.hpp>
+
+int main()
+{
+  constexpr std::size_t size = 1'000'000;
+
+  using rational = std::experimental::rational<std::int32_t>;
+
+  std::mt19937                                generator(0);
+  std::uniform_int_distribution<std::int32_t> distribution(1, 1'000);
+
+  std::vector<rational>                              structures(size);
+  std::experimental::rational_vector<std::int32_t>   arrays    (size);
+  for (std::size_t i = 0; i < size; ++i)
+    arrays[i] = structures[i] = rational(distribution(generator), distribution(generator));
+
+  benchmark::measure("add integer (array of structures)"     , size, 10, [&]
+  {
+    for (auto& value : structures)
+      value += 1;
+    benchmark::do_not_optimize(structures.data());
+  });
+  benchmark::measure("add integer (rational_vector)"         , size, 10, [&]
+  {
+    arrays.add(rational(1));
+    benchmark::do_not_optimize(arrays.numerators().data());
+  });
+
+  benchmark::measure("scale (array of structures)"           , size, 10, [&]
+  {
+    for (auto& value : structures)
+      value *= rational(-1);
+    benchmark::do_not_optimize(structures.data());
+  });
+  benchmark::measure("scale (rational_vector)"               , size, 10, [&]
+  {
+    arrays.scale(rational(-1));
+    benchmark::do_not_optimize(arrays.numerators().data());
+  });
+
+  benchmark::measure("normalize (array of structures)"       , size, 10, [&]
+  {
+    for (auto& value : structures)
+      value = rational(value.numerator() * 6, value.denominator() * 6);
+    benchmark::do_not_optimize(structures.data());
+  });
+  benchmark::measure("normalize (rational_vector)"           , size, 10, [&]
+  {
+    const auto span = arrays.span();
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      span.numerators  [i] *= 6;
+      span.denominators[i] *= 6;
+    }
+    arrays.normalize();
+    benchmark::do_not_optimize(arrays.numerators().data());
+  });
+
+  return 0;
+}
@@ -0,0 +1,586 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+namespace std::experimental
+{
+namespace detail
+{
+// The memory resource of the big integers with polymorphic allocators constructed on this thread (see rational_arena), or null for
+// std::pmr::get_default_resource().
+inline std::pmr::memory_resource*& current_resource()
+{
+  thread_local std::pmr::memory_resource* resource = nullptr;
+  return resource;
+}
+}
+
+// An arbitrary-precision signed integer, e.g. for rational<big_integer>, which can not overflow. The semantics follow the built-in
+// integers: Division truncates towards zero and the remainder takes the sign of the dividend. The shifts apply to the magnitude.
+// The magnitude is stored as 32-bit limbs (least significant first, without leading zero limbs), whose products are exact in 64 bits
+// on all platforms. Zero is non-negative and has no limbs, hence the representation of each value is unique.
+// The limbs are allocated with the given allocator. A polymorphic allocator (see pmr::big_integer) is constructed from the current
+// resource of the thread whenever limbs are allocated, including copies and the temporaries of the arithmetic, such that all integers
+// of a computation within the scope of a rational_arena are allocated from the arena.
+template <typename allocator = std::allocator<std::uint32_t>>
+class basic_big_integer
+{
+public:
+  using limb_type      = std::uint32_t;
+  using wide_type      = std::uint64_t;
+  using allocator_type = allocator;
+  using limbs          = std::vector<limb_type, allocator_type>;
+
+  static constexpr auto limb_bits = std::numeric_limits<limb_type>::digits;
+
+  // Constructors and destructor.
+  constexpr basic_big_integer         ()
+  : limbs_(current_allocator())
+  {
+
+  }
+  template <std::integral that_type> requires (!std::same_as<that_type, bool>)
+  constexpr basic_big_integer         (const that_type value)
+  : limbs_(current_allocator())
+  {
+    if constexpr (std::is_signed_v<that_type>)
+      negative_ = value < that_type(0);
+
+    auto magnitude = detail::uabs(value);
+    if constexpr (sizeof(that_type) <= sizeof(limb_type))
+    {
+      if (magnitude != 0)
+        limbs_.push_back(static_cast<limb_type>(magnitude));
+    }
+    else
+      for (; magnitude != 0; magnitude >>= limb_bits)
+        limbs_.push_back(static_cast<limb_type>(magnitude));
+  }
+  template <typename that_allocator>
+  explicit constexpr basic_big_integer(const basic_big_integer<that_allocator>& that)
+  : limbs_(that.limbs_.begin(), that.limbs_.end(), current_allocator()), negative_(that.negative_)
+  {
+
+  }
+  constexpr basic_big_integer         (const basic_big_integer&  that)
+  : limbs_(that.limbs_, current_allocator()), negative_(that.negative_)
+  {
+
+  }
+  constexpr basic_big_integer         (      basic_big_integer&& temp) = default;
+  constexpr ~basic_big_integer        ()                               = default;
+
+  // Assignment operators.
+  constexpr basic_big_integer& operator=  (const basic_big_integer&  that) = default;
+  constexpr basic_big_integer& operator=  (      basic_big_integer&& temp) = default;
+
+  // Conversion operators. The conversions to integers keep the low bits (wrap around, as conversions between built-in integers do).
+  template <std::integral that_type> requires (!std::same_as<that_type, bool>)
+  explicit constexpr operator that_type() const
+  {
+    using unsigned_type = std::make_unsigned_t<that_type>;
+
+    unsigned_type result(0);
+    if constexpr (sizeof(that_type) <= sizeof(limb_type))
+    {
+      if (!limbs_.empty())
+        result = static_cast<unsigned_type>(limbs_.front());
+    }
+    else
+      for (auto i = std::min(limbs_.size(), sizeof(that_type) / sizeof(limb_type)); i-- > 0;)
+        result = static_cast<unsigned_type>(result << limb_bits) | limbs_[i];
+    return static_cast<that_type>(negative_ ? unsigned_type(unsigned_type(0) - result) : result);
+  }
+  // Approximate (the limbs are accumulated from the most significant one, rounding after each).
+  template <std::floating_point that_type>
+  explicit constexpr operator that_type() const
+  {
+    auto result = that_type(0);
+    for (auto i = limbs_.size(); i-- > 0;)
+      result = result * (that_type(1) + static_cast<that_type>(std::numeric_limits<limb_type>::max())) + static_cast<that_type>(limbs_[i]);
+    return negative_ ? -result : result;
+  }
+  explicit constexpr operator bool() const
+  {
+    return !limbs_.empty();
+  }
+
+  // Comparison operators.
+  friend constexpr bool                 operator== (const basic_big_integer& lhs, const basic_big_integer& rhs) = default;
+  friend constexpr std::strong_ordering operator<=>(const basic_big_integer& lhs, const basic_big_integer& rhs)
+  {
+    if (lhs.negative_ != rhs.negative_)
+      return lhs.negative_ ? std::strong_ordering::less : std::strong_ordering::greater;
+    const auto result = compare_magnitudes(lhs.limbs_, rhs.limbs_);
+    return lhs.negative_ ? 0 <=> result : result;
+  }
+
+  // Unary arithmetic operators.
+  constexpr basic_big_integer  operator+  () const
+  {
+    return *this;
+  }
+  constexpr basic_big_integer  operator-  () const
+  {
+    auto result = *this;
+    result.negative_ = !negative_ && !limbs_.empty();
+    return result;
+  }
+
+  // Arithmetic assignment operators.
+  constexpr basic_big_integer& operator+= (const basic_big_integer& that)
+  {
+    add(that.limbs_, that.negative_);
+    return *this;
+  }
+  constexpr basic_big_integer& operator-= (const basic_big_integer& that)
+  {
+    add(that.limbs_, !that.negative_ && !that.limbs_.empty());
+    return *this;
+  }
+  constexpr basic_big_integer& operator*= (const basic_big_integer& that)
+  {
+    limbs_    = multiply_magnitudes(limbs_, that.limbs_);
+    negative_ = negative_ != that.negative_ && !limbs_.empty();
+    return *this;
+  }
+  constexpr basic_big_integer& operator/= (const basic_big_integer& that)
+  {
+    limbs quotient(current_allocator()), remainder(current_allocator());
+    divide_magnitudes(limbs_, that.limbs_, quotient, remainder);
+    limbs_    = std::move(quotient);
+    negative_ = negative_ != that.negative_ && !limbs_.empty();
+    return *this;
+  }
+  constexpr basic_big_integer& operator%= (const basic_big_integer& that)
+  {
+    limbs quotient(current_allocator()), remainder(current_allocator());
+    divide_magnitudes(limbs_, that.limbs_, quotient, remainder);
+    limbs_    = std::move(remainder);
+    negative_ = negative_ && !limbs_.empty();
+    return *this;
+  }
+  constexpr basic_big_integer& operator<<=(const int shift)
+  {
+    limbs_    = shift_left (limbs_, shift);
+    return *this;
+  }
+  constexpr basic_big_integer& operator>>=(const int shift)
+  {
+    limbs_    = shift_right(limbs_, shift);
+    negative_ = negative_ && !limbs_.empty();
+    return *this;
+  }
+
+  // Increment and decrement operators.
+  constexpr basic_big_integer& operator++ ()
+  {
+    return *this += basic_big_integer(1);
+  }
+  constexpr basic_big_integer& operator-- ()
+  {
+    return *this -= basic_big_integer(1);
+  }
+  constexpr basic_big_integer  operator++ (int)
+  {
+    auto result = *this;
+    ++(*this);
+    return result;
+  }
+  constexpr basic_big_integer  operator-- (int)
+  {
+    auto result = *this;
+    --(*this);
+    return result;
+  }
+
+  // Binary arithmetic operators.
+  friend constexpr basic_big_integer operator+ (basic_big_integer lhs, const basic_big_integer& rhs) { return lhs +=  rhs; }
+  friend constexpr basic_big_integer operator- (basic_big_integer lhs, const basic_big_integer& rhs) { return lhs -=  rhs; }
+  friend constexpr basic_big_integer operator* (const basic_big_integer& lhs, const basic_big_integer& rhs)
+  {
+    basic_big_integer result;
+    result.limbs_    = multiply_magnitudes(lhs.limbs_, rhs.limbs_);
+    result.negative_ = lhs.negative_ != rhs.negative_ && !result.limbs_.empty();
+    return result;
+  }
+  friend constexpr basic_big_integer operator/ (basic_big_integer lhs, const basic_big_integer& rhs) { return lhs /=  rhs; }
+  friend constexpr basic_big_integer operator% (basic_big_integer lhs, const basic_big_integer& rhs) { return lhs %=  rhs; }
+  friend constexpr basic_big_integer operator<<(basic_big_integer lhs, const int shift       ) { return lhs <<= shift; }
+  friend constexpr basic_big_integer operator>>(basic_big_integer lhs, const int shift       ) { return lhs >>= shift; }
+
+  // Number of bits required to represent the magnitude.
+  [[nodiscard]]
+  constexpr std::size_t bit_width() const
+  {
+    return limbs_.empty() ? 0 : (limbs_.size() - 1) * limb_bits + static_cast<std::size_t>(std::bit_width(limbs_.back()));
+  }
+  // The allocator of the limbs.
+  [[nodiscard]]
+  constexpr allocator_type get_allocator() const
+  {
+    return limbs_.get_allocator();
+  }
+
+  // Math functions.
+  friend constexpr basic_big_integer abs(basic_big_integer value)
+  {
+    value.negative_ = false;
+    return value;
+  }
+
+  // Stream operators (decimal).
+  [[nodiscard]]
+  std::string to_string() const
+  {
+    // Divides by 10^9 repeatedly, each remainder yielding nine digits (least significant first).
+    constexpr limb_type chunk = 1'000'000'000;
+
+    std::string result;
+    limbs magnitude(limbs_, current_allocator());
+    while (!magnitude.empty())
+    {
+      auto remainder = divide_by_limb(magnitude, chunk);
+      for (auto i = 0; i < 9 && (!magnitude.empty() || remainder != 0); ++i, remainder /= 10)
+        result.push_back(static_cast<char>('0' + remainder % 10));
+    }
+    if (result.empty())
+      result.push_back('0');
+    if (negative_)
+      result.push_back('-');
+    std::reverse(result.begin(), result.end());
+    return result;
+  }
+  template <typename char_type, typename traits>
+  friend std::basic_ostream<char_type, traits>& operator<<(std::basic_ostream<char_type, traits>& stream, const basic_big_integer& value)
+  {
+    return stream << value.to_string().c_str();
+  }
+  template <typename char_type, typename traits>
+  friend std::basic_istream<char_type, traits>& operator>>(std::basic_istream<char_type, traits>& stream,       basic_big_integer& value)
+  {
+    const typename std::basic_istream<char_type, traits>::sentry sentry(stream);
+    if (!sentry)
+      return stream;
+
+    auto result   = basic_big_integer();
+    auto negative = false;
+    auto digits   = 0;
+    if (const auto sign = traits::to_char_type(stream.peek()); sign == char_type('-') || sign == char_type('+'))
+    {
+      negative = sign == char_type('-');
+      stream.get();
+    }
+    for (auto next = stream.peek(); !traits::eq_int_type(next, traits::eof()); next = stream.peek())
+    {
+      const auto digit = traits::to_char_type(next);
+      if (digit < char_type('0') || digit > char_type('9'))
+        break;
+      multiply_add(result.limbs_, 10, static_cast<limb_type>(digit - char_type('0')));
+      stream.get();
+      ++digits;
+    }
+
+    if (digits == 0)
+      stream.setstate(std::ios_base::failbit);
+    else
+    {
+      result.negative_ = negative && !result.limbs_.empty();
+      value = std::move(result);
+    }
+    return stream;
+  }
+
+protected:
+  // Adds the value with the given magnitude and sign.
+  constexpr void add(const limbs& magnitude, const bool negative)
+  {
+    if (negative_ == negative)
+      add_magnitudes(limbs_, magnitude);
+    else if (compare_magnitudes(limbs_, magnitude) >= 0)
+      subtract_magnitudes(limbs_, magnitude);
+    else
+    {
+      limbs result(magnitude, current_allocator());
+      subtract_magnitudes(result, limbs_);
+      limbs_    = std::move(result);
+      negative_ = negative;
+    }
+    negative_ = negative_ && !limbs_.empty();
+  }
+
+  // Arithmetic on magnitudes. The operands may alias.
+  static constexpr std::strong_ordering compare_magnitudes (const limbs& lhs, const limbs& rhs)
+  {
+    if (lhs.size() != rhs.size())
+      return lhs.size() <=> rhs.size();
+    for (auto i = lhs.size(); i-- > 0;)
+      if (lhs[i] != rhs[i])
+        return lhs[i] <=> rhs[i];
+    return std::strong_ordering::equal;
+  }
+  static constexpr void                 add_magnitudes     (limbs& lhs, const limbs& rhs)
+  {
+    const auto size = rhs.size();
+    if (lhs.size() < size)
+      lhs.resize(size, limb_type(0));
+
+    wide_type carry(0);
+    for (std::size_t i = 0; i < lhs.size() && (i < size || carry != 0); ++i)
+    {
+      carry += static_cast<wide_type>(lhs[i]) + (i < size ? rhs[i] : limb_type(0));
+      lhs[i] = static_cast<limb_type>(carry);
+      carry >>= limb_bits;
+    }
+    if (carry != 0)
+      lhs.push_back(static_cast<limb_type>(carry));
+  }
+  // Requires lhs >= rhs.
+  static constexpr void                 subtract_magnitudes(limbs& lhs, const limbs& rhs)
+  {
+    const auto size = rhs.size();
+
+    wide_type borrow(0);
+    for (std::size_t i = 0; i < size || borrow != 0; ++i)
+    {
+      const auto subtrahend = static_cast<wide_type>(i < size ? rhs[i] : limb_type(0)) + borrow;
+      borrow = lhs[i] < subtrahend ? 1 : 0;
+      lhs[i] = static_cast<limb_type>(lhs[i] - subtrahend);
+    }
+    trim(lhs);
+  }
+  static constexpr limbs                multiply_magnitudes(const limbs& lhs, const limbs& rhs)
+  {
+    if (lhs.empty() || rhs.empty())
+      return limbs(current_allocator());
+
+    // Schoolbook multiplication. (2^32 - 1)^2 + 2 (2^32 - 1) = 2^64 - 1, hence the accumulation can not overflow.
+    limbs result(lhs.size() + rhs.size(), limb_type(0), current_allocator());
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+      wide_type carry(0);
+      for (std::size_t j = 0; j < rhs.size(); ++j)
+      {
+        carry        += static_cast<wide_type>(lhs[i]) * rhs[j] + result[i + j];
+        result[i + j] = static_cast<limb_type>(carry);
+        carry       >>= limb_bits;
+      }
+      result[i + rhs.size()] = static_cast<limb_type>(carry);
+    }
+    trim(result);
+    return result;
+  }
+  // Long division (see Knuth TAOCP Vol. 2, 4.3.1, Algorithm D). Throws std::domain_error on division by zero.
+  static constexpr void                 divide_magnitudes  (const limbs& dividend, const limbs& divisor, limbs& quotient, limbs& remainder)
+  {
+    if (divisor.empty())
+      detail::throw_error(rational_errc::division_by_zero);
+    if (compare_magnitudes(dividend, divisor) < 0)
+    {
+      quotient .clear();
+      remainder = dividend;
+      return;
+    }
+    if (divisor.size() == 1)
+    {
+      quotient  = dividend;
+      const auto result = divide_by_limb(quotient, divisor.front());
+      remainder.assign(result != 0 ? 1 : 0, result);
+      return;
+    }
+
+    // Normalize such that the most significant bit of the divisor is set, which bounds the error of each estimated quotient limb by 2.
+    constexpr auto base  = wide_type(1) << limb_bits;
+    const     auto shift = std::countl_zero(divisor.back());
+    const     auto v     = shift_left(divisor , shift);
+    auto           u     = shift_left(dividend, shift);
+    u.resize(dividend.size() + 1, limb_type(0));
+
+    const auto n = v.size();
+    const auto m = dividend.size() - n;
+    quotient.assign(m + 1, limb_type(0));
+    for (auto j = m + 1; j-- > 0;)
+    {
+      // Estimate the quotient limb from the leading limbs, and correct it by the next one.
+      const auto numerator = (static_cast<wide_type>(u[j + n]) << limb_bits) | u[j + n - 1];
+      auto       estimate  = numerator / v[n - 1];
+      auto       rest      = numerator % v[n - 1];
+      while (estimate >= base || estimate * v[n - 2] > ((rest << limb_bits) | u[j + n - 2]))
+      {
+        --estimate;
+        rest += v[n - 1];
+        if (rest >= base)
+          break;
+      }
+
+      // Multiply and subtract.
+      std::int64_t borrow(0);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        const auto product    = estimate * v[i];
+        const auto difference = static_cast<std::int64_t>(u[i + j]) - borrow - static_cast<std::int64_t>(product & (base - 1));
+        u[i + j] = static_cast<limb_type>(difference);
+        borrow   = static_cast<std::int64_t>(product >> limb_bits) - (difference >> limb_bits);
+      }
+      const auto difference = static_cast<std::int64_t>(u[j + n]) - borrow;
+      u[j + n] = static_cast<limb_type>(difference);
+
+      // The estimate was one too large (rarely): Add back.
+      if (difference < 0)
+      {
+        --estimate;
+        wide_type carry(0);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          carry   += static_cast<wide_type>(u[i + j]) + v[i];
+          u[i + j] = static_cast<limb_type>(carry);
+          carry  >>= limb_bits;
+        }
+        u[j + n] = static_cast<limb_type>(u[j + n] + carry);
+      }
+      quotient[j] = static_cast<limb_type>(estimate);
+    }
+    trim(quotient);
+
+    u.resize(n);
+    trim(u);
+    remainder = shift_right(u, shift);
+  }
+  // Divides in place by a single limb, and returns the remainder.
+  static constexpr limb_type            divide_by_limb     (limbs& value, const limb_type divisor)
+  {
+    wide_type remainder(0);
+    for (auto i = value.size(); i-- > 0;)
+    {
+      const auto current = (remainder << limb_bits) | value[i];
+      value[i]  = static_cast<limb_type>(current / divisor);
+      remainder = current % divisor;
+    }
+    trim(value);
+    return static_cast<limb_type>(remainder);
+  }
+  // value = value * factor + addend.
+  static constexpr void                 multiply_add       (limbs& value, const limb_type factor, const limb_type addend)
+  {
+    wide_type carry(addend);
+    for (auto& limb : value)
+    {
+      carry += static_cast<wide_type>(limb) * factor;
+      limb   = static_cast<limb_type>(carry);
+      carry >>= limb_bits;
+    }
+    if (carry != 0)
+      value.push_back(static_cast<limb_type>(carry));
+  }
+  static constexpr limbs                shift_left         (const limbs& value, const int shift)
+  {
+    if (value.empty())
+      return limbs(current_allocator());
+
+    const auto limb_shift = static_cast<std::size_t>(shift / limb_bits);
+    const auto bit_shift  = shift % limb_bits;
+    limbs result(value.size() + limb_shift + 1, limb_type(0), current_allocator());
+    for (std::size_t i = 0; i < value.size(); ++i)
+    {
+      const auto shifted = static_cast<wide_type>(value[i]) << bit_shift;
+      result[i + limb_shift    ] |= static_cast<limb_type>(shifted);
+      result[i + limb_shift + 1] |= static_cast<limb_type>(shifted >> limb_bits);
+    }
+    trim(result);
+    return result;
+  }
+  static constexpr limbs                shift_right        (const limbs& value, const int shift)
+  {
+    const auto limb_shift = static_cast<std::size_t>(shift / limb_bits);
+    const auto bit_shift  = shift % limb_bits;
+    if (limb_shift >= value.size())
+      return limbs(current_allocator());
+
+    limbs result(value.size() - limb_shift, limb_type(0), current_allocator());
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+      const auto high = i + limb_shift + 1 < value.size() ? static_cast<wide_type>(value[i + limb_shift + 1]) << limb_bits : wide_type(0);
+      result[i] = static_cast<limb_type>((high | value[i + limb_shift]) >> bit_shift);
+    }
+    trim(result);
+    return result;
+  }
+  // The allocator for new limbs.
+  static constexpr allocator_type       current_allocator  ()
+  {
+    if constexpr (std::is_same_v<allocator_type, std::pmr::polymorphic_allocator<limb_type>>)
+      return allocator_type(detail::current_resource() ? detail::current_resource() : std::pmr::get_default_resource());
+    else
+      return allocator_type();
+  }
+  // Removes leading zero limbs.
+  static constexpr void                 trim               (limbs& value)
+  {
+    while (!value.empty() && value.back() == limb_type(0))
+      value.pop_back();
+  }
+
+  template <typename>
+  friend class basic_big_integer;
+
+  limbs limbs_    ;
+  bool  negative_ = false;
+};
+
+using big_integer = basic_big_integer<>;
+
+namespace pmr
+{
+using big_integer = basic_big_integer<std::pmr::polymorphic_allocator<std::uint32_t>>;
+}
+}
+
+// An unbounded integer (see std::experimental::integral).
+template <typename allocator>
+struct std::numeric_limits<std::experimental::basic_big_integer<allocator>>
+{
+  static constexpr bool                    is_specialized    = true ;
+  static constexpr bool                    is_signed         = true ;
+  static constexpr bool                    is_integer        = true ;
+  static constexpr bool                    is_exact          = true ;
+  static constexpr bool                    has_infinity      = false;
+  static constexpr bool                    has_quiet_NaN     = false;
+  static constexpr bool                    has_signaling_NaN = false;
+  static constexpr bool                    is_bounded        = false;
+  static constexpr bool                    is_modulo         = false;
+  static constexpr int                     digits            = 0    ;
+  static constexpr int                     digits10          = 0    ;
+  static constexpr int                     radix             = 2    ;
+  static constexpr std::float_round_style  round_style       = std::round_toward_zero;
+
+  static constexpr std::experimental::basic_big_integer<allocator> min   () { return {}; }
+  static constexpr std::experimental::basic_big_integer<allocator> max   () { return {}; }
+  static constexpr std::experimental::basic_big_integer<allocator> lowest() { return {}; }
+};
+
+namespace std::experimental
+{
+// Lehmer's gcd of the magnitudes (see detail::lehmer_gcd), found by argument-dependent lookup from detail::gcd. Defined after the
+// specialization of std::numeric_limits, which the latter depends on.
+template <typename allocator>
+constexpr basic_big_integer<allocator> gcd(const basic_big_integer<allocator>& lhs, const basic_big_integer<allocator>& rhs)
+{
+  return detail::lehmer_gcd(abs(lhs), abs(rhs));
+}
+}
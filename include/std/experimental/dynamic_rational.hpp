@@ -0,0 +1,237 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+
+#include <std/experimental/big_integer.hpp>
+#include <std/experimental/rational.hpp>
+
+namespace std::experimental
+{
+// A rational that does not overflow, and costs about as much as a rational of 64-bit integers as long as its value fits one: The
+// value is stored inline as a rational<std::int64_t> and promoted to a heap-allocated rational<big_integer> only when an operation
+// overflows (detected with the overflow builtins). Results of the promoted arithmetic that fit 64 bits again (after canonization)
+// are demoted back to the inline representation.
+class dynamic_rational
+{
+public:
+  using small_type = rational<std::int64_t>;
+  using large_type = rational<big_integer>;
+
+  // Constructors and destructor.
+  constexpr dynamic_rational         (const std::int64_t numerator = 0, const std::int64_t denominator = 1)
+  : small_(numerator, denominator)
+  {
+
+  }
+  constexpr dynamic_rational         (const small_type& value)
+  : small_(value)
+  {
+
+  }
+  dynamic_rational                   (const large_type& value)
+  {
+    assign_large(value);
+  }
+  dynamic_rational                   (const big_integer& numerator, const big_integer& denominator = big_integer(1))
+  {
+    assign_large(large_type(numerator, denominator));
+  }
+  dynamic_rational                   (const dynamic_rational&  that)
+  : small_(that.small_), large_(that.large_ ? std::make_unique<large_type>(*that.large_) : nullptr)
+  {
+
+  }
+  dynamic_rational                   (      dynamic_rational&& temp) noexcept = default;
+  ~dynamic_rational                  ()                                       = default;
+
+  // Assignment operators.
+  dynamic_rational&           operator=  (const dynamic_rational&  that)
+  {
+    if (this != &that)
+    {
+      small_ = that.small_;
+      large_ = that.large_ ? std::make_unique<large_type>(*that.large_) : nullptr;
+    }
+    return *this;
+  }
+  dynamic_rational&           operator=  (      dynamic_rational&& temp) noexcept = default;
+
+  // Comparison operators.
+  friend bool                 operator== (const dynamic_rational& lhs, const dynamic_rational& rhs)
+  {
+    if (lhs.is_inline() && rhs.is_inline())
+      return lhs.small_ == rhs.small_;
+    return lhs.large() == rhs.large();
+  }
+  friend std::strong_ordering operator<=>(const dynamic_rational& lhs, const dynamic_rational& rhs)
+  {
+    if (lhs.is_inline() && rhs.is_inline())
+      return lhs.small_ <=> rhs.small_;
+    return lhs.large() <=> rhs.large();
+  }
+
+  // Unary arithmetic operators.
+  dynamic_rational            operator+  () const
+  {
+    return *this;
+  }
+  dynamic_rational            operator-  () const
+  {
+    if (is_inline() && small_.numerator() != std::numeric_limits<std::int64_t>::min())
+      return -small_;
+    return dynamic_rational(-large());
+  }
+
+  // Arithmetic assignment operators.
+  dynamic_rational&           operator+= (const dynamic_rational& that)
+  {
+    if (!(is_inline() && that.is_inline() && try_add(that.small_, false)))
+      assign_large(large() + that.large());
+    return *this;
+  }
+  dynamic_rational&           operator-= (const dynamic_rational& that)
+  {
+    if (!(is_inline() && that.is_inline() && try_add(that.small_, true )))
+      assign_large(large() - that.large());
+    return *this;
+  }
+  dynamic_rational&           operator*= (const dynamic_rational& that)
+  {
+    if (!(is_inline() && that.is_inline() && try_multiply(that.small_.numerator(), that.small_.denominator())))
+      assign_large(large() * that.large());
+    return *this;
+  }
+  dynamic_rational&           operator/= (const dynamic_rational& that)
+  {
+    if (that.is_inline() && that.small_.numerator() == 0)
+      detail::throw_error(rational_errc::division_by_zero);
+    if (!(is_inline() && that.is_inline() && try_multiply(that.small_.denominator(), that.small_.numerator())))
+      assign_large(large() / that.large());
+    return *this;
+  }
+
+  // Binary arithmetic operators.
+  friend dynamic_rational     operator+  (dynamic_rational lhs, const dynamic_rational& rhs) { return lhs += rhs; }
+  friend dynamic_rational     operator-  (dynamic_rational lhs, const dynamic_rational& rhs) { return lhs -= rhs; }
+  friend dynamic_rational     operator*  (dynamic_rational lhs, const dynamic_rational& rhs) { return lhs *= rhs; }
+  friend dynamic_rational     operator/  (dynamic_rational lhs, const dynamic_rational& rhs) { return lhs /= rhs; }
+
+  // Observers.
+  // Whether the value is stored inline, i.e. its numerator and denominator fit 64 bits.
+  [[nodiscard]]
+  bool                        is_inline  () const
+  {
+    return !large_;
+  }
+  [[nodiscard]]
+  big_integer                 numerator  () const
+  {
+    return is_inline() ? big_integer(small_.numerator  ()) : large_->numerator  ();
+  }
+  [[nodiscard]]
+  big_integer                 denominator() const
+  {
+    return is_inline() ? big_integer(small_.denominator()) : large_->denominator();
+  }
+  // The value as a rational of 64-bit integers. Throws std::overflow_error if it does not fit.
+  explicit operator           small_type () const
+  {
+    if (!is_inline())
+      detail::throw_error(rational_errc::overflow);
+    return small_;
+  }
+  explicit operator           large_type () const
+  {
+    return large();
+  }
+
+  // Stream operators.
+  template <typename char_type, typename traits>
+  friend std::basic_ostream<char_type, traits>& operator<<(std::basic_ostream<char_type, traits>& stream, const dynamic_rational& value)
+  {
+    return value.is_inline() ? stream << value.small_ : stream << *value.large_;
+  }
+
+protected:
+  // a/b +- c/d = (a(d/g) +- c(b/g)) / (b/g)d where g = gcd(b, d), as rational::operator+=. Returns false (leaving the value
+  // unmodified) on overflow.
+  bool try_add     (const small_type& that, const bool subtract)
+  {
+    const auto a = small_.numerator(), b = small_.denominator(), c = that.numerator(), d = that.denominator();
+    const auto divisor = detail::gcd(b, d);
+
+    std::int64_t lhs, rhs, t, denominator;
+    if (detail::multiply_overflow(a, d / divisor, lhs) || detail::multiply_overflow(c, b / divisor, rhs) ||
+        (subtract ? detail::subtract_overflow(lhs, rhs, t) : detail::add_overflow(lhs, rhs, t)))
+      return false;
+
+    if (t == 0)
+    {
+      assign_small(0, 1);
+      return true;
+    }
+
+    // Any common factor of t and (b/g)d is a factor of g.
+    const auto reducer = detail::gcd(t, divisor);
+    if (detail::multiply_overflow(b / divisor, d / reducer, denominator))
+      return false;
+    assign_small(t / reducer, denominator);
+    return true;
+  }
+  // a/b * c/d = (a/g1)(c/g2) / (b/g2)(d/g1) where g1 = gcd(a, d) and g2 = gcd(c, b), as rational::operator*=. Returns false (leaving
+  // the value unmodified) on overflow, or if the sign of a negative denominator c/d can not be moved to the numerator.
+  bool try_multiply(const std::int64_t c, const std::int64_t d)
+  {
+    const auto a = small_.numerator(), b = small_.denominator();
+    const auto lhs_divisor = detail::gcd(a, d);
+    const auto rhs_divisor = detail::gcd(c, b);
+
+    std::int64_t numerator, denominator;
+    if (detail::multiply_overflow(a / lhs_divisor, c / rhs_divisor, numerator) || detail::multiply_overflow(b / rhs_divisor, d / lhs_divisor, denominator))
+      return false;
+    if (denominator < 0)
+    {
+      if (numerator == std::numeric_limits<std::int64_t>::min() || denominator == std::numeric_limits<std::int64_t>::min())
+        return false;
+      numerator   = -numerator  ;
+      denominator = -denominator;
+    }
+    assign_small(numerator, denominator);
+    return true;
+  }
+
+  // Assigns a canonical value inline.
+  void assign_small(const std::int64_t numerator, const std::int64_t denominator)
+  {
+    small_ = small_type(canonical, numerator, denominator);
+  }
+  // Assigns a canonical value, inline if it fits.
+  void assign_large(const large_type& value)
+  {
+    // Magnitudes below 2^63 fit (conservatively excluding -2^63).
+    constexpr auto digits = static_cast<std::size_t>(std::numeric_limits<std::int64_t>::digits);
+    if (value.numerator().bit_width() <= digits && value.denominator().bit_width() <= digits)
+    {
+      assign_small(static_cast<std::int64_t>(value.numerator()), static_cast<std::int64_t>(value.denominator()));
+      large_.reset();
+    }
+    else if (large_)
+      *large_ = value;
+    else
+      large_ = std::make_unique<large_type>(value);
+  }
+  // The value as a rational of big integers.
+  [[nodiscard]]
+  large_type large() const
+  {
+    return is_inline() ? large_type(big_integer(small_.numerator()), big_integer(small_.denominator())) : *large_;
+  }
+
+  small_type                  small_;
+  std::unique_ptr<large_type> large_;
+};
+}
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <iostream>
+#include <ratio>
+#include <utility>
+
+#include <std/experimental/rational.hpp>
+
+namespace std::experimental
+{
+namespace detail
+{
+// Whether numerator * scale is representable in the integer type, for the constraints on the conversions from std::ratio.
+template <integral type>
+constexpr bool scaled_in_range(const std::intmax_t numerator, const std::intmax_t scale)
+{
+  type result;
+  return std::in_range<type>(numerator) && std::in_range<type>(scale) && !multiply_overflow(static_cast<type>(numerator), static_cast<type>(scale), result);
+}
+}
+
+// A rational of a built-in integral type whose denominator is fixed at compile time (e.g. the timebases 1/90000, 1/48000, 1/1000000),
+// storing only the numerator: Addition and subtraction are a single integer operation, and multiplication by an integer requires no
+// gcd. The stored fraction is not canonical (e.g. 45000/90000), the conversion to rational is. The conversion from rational is exact,
+// and fails with rational_errc::not_representable if the denominator of the value does not divide the fixed one. Overflow is handled
+// by the policy, as in rational.
+template <integral type, type denominator_value, overflow_policy policy = unchecked_policy>
+requires (denominator_value > type(0))
+class fixed_rational
+{
+public:
+  using value_type = rational<type, policy>;
+  using period     = std::ratio<1, static_cast<std::intmax_t>(denominator_value)>;
+
+  // Constructors and destructor.
+  // The value numerator / denominator_value.
+  constexpr explicit fixed_rational         (const type& numerator = type(0))
+  : numerator_(numerator)
+  {
+
+  }
+  constexpr explicit fixed_rational         (const value_type& value)
+  {
+    if (const auto error = assign(value); error != rational_errc())
+      detail::throw_error(error);
+  }
+  // Exact for any value if the denominator of the other fixed_rational divides this one's (implicit), otherwise as from rational.
+  template <type that_denominator>
+  constexpr explicit(denominator_value % that_denominator != type(0)) fixed_rational(const fixed_rational<type, that_denominator, policy>& that)
+  {
+    if constexpr (denominator_value % that_denominator == type(0))
+      numerator_ = policy::multiply(that.numerator(), static_cast<type>(denominator_value / that_denominator));
+    else if (const auto error = assign(static_cast<value_type>(that)); error != rational_errc())
+      detail::throw_error(error);
+  }
+  // The value of a std::ratio whose denominator divides this one's, and whose scaled numerator fits the integer type (both checked at 
+  // compile time).
+  template <std::intmax_t ratio_numerator, std::intmax_t ratio_denominator>
+  requires (static_cast<std::intmax_t>(denominator_value) % ratio_denominator == 0 &&
+            detail::scaled_in_range<type>(ratio_numerator, static_cast<std::intmax_t>(denominator_value) / ratio_denominator))
+  constexpr fixed_rational                  (std::ratio<ratio_numerator, ratio_denominator>)
+  : numerator_(static_cast<type>(static_cast<type>(ratio_numerator) * static_cast<type>(static_cast<std::intmax_t>(denominator_value) / ratio_denominator)))
+  {
+
+  }
+  constexpr fixed_rational                  (const fixed_rational&  that) = default;
+  constexpr fixed_rational                  (      fixed_rational&& temp) = default;
+  constexpr ~fixed_rational                 ()                            = default;
+
+  // Assignment operators.
+  constexpr fixed_rational&      operator=  (const fixed_rational&  that) = default;
+  constexpr fixed_rational&      operator=  (      fixed_rational&& temp) = default;
+
+  // Comparison operators.
+  constexpr bool                 operator== (const fixed_rational&  that) const = default;
+  constexpr std::strong_ordering operator<=>(const fixed_rational&  that) const
+  {
+    return numerator_ <=> that.numerator_;
+  }
+
+  // Unary arithmetic operators.
+  constexpr fixed_rational       operator+  () const
+  {
+    return *this;
+  }
+  constexpr fixed_rational       operator-  () const
+  {
+    return fixed_rational(policy::subtract(type(0), numerator_));
+  }
+
+  // Arithmetic assignment operators.
+  constexpr fixed_rational&      operator+= (const fixed_rational&  that)
+  {
+    numerator_ = policy::add     (numerator_, that.numerator_);
+    return *this;
+  }
+  constexpr fixed_rational&      operator-= (const fixed_rational&  that)
+  {
+    numerator_ = policy::subtract(numerator_, that.numerator_);
+    return *this;
+  }
+  constexpr fixed_rational&      operator*= (const type&            that)
+  {
+    numerator_ = policy::multiply(numerator_, that);
+    return *this;
+  }
+
+  // Accessors.
+  [[nodiscard]]
+  constexpr type                 numerator  () const
+  {
+    return numerator_;
+  }
+  [[nodiscard]]
+  static constexpr type          denominator()
+  {
+    return denominator_value;
+  }
+
+  // Conversions.
+  // The canonical value (a single gcd).
+  constexpr explicit operator    value_type () const
+  {
+    return value_type(numerator_, denominator_value);
+  }
+  // Floating point results are correctly rounded (to nearest, ties to even), integral results are truncated.
+  template <arithmetic result_type> [[nodiscard]]
+  constexpr result_type          evaluate   () const
+  {
+    if constexpr (std::is_floating_point_v<result_type>)
+      return detail::to_floating_point<result_type>(numerator_, denominator_value, std::round_to_nearest);
+    else
+      return static_cast<result_type>(numerator_) / static_cast<result_type>(denominator_value);
+  }
+
+#if defined(__cpp_lib_expected)
+  // Exception-free interface.
+  [[nodiscard]]
+  static constexpr std::expected<fixed_rational, rational_errc> make(const value_type& value) noexcept
+  {
+    fixed_rational result;
+    if (const auto error = result.assign(value); error != rational_errc())
+      return std::unexpected(error);
+    return result;
+  }
+#endif
+
+protected:
+  // a/b = a(D/b) / D if b divides D. The canonical denominator b divides D if any denominator of the value does.
+  constexpr rational_errc assign(const value_type& value)
+  {
+    if (denominator_value % value.denominator() != type(0))
+      return rational_errc::not_representable;
+
+    numerator_ = policy::multiply(value.numerator(), static_cast<type>(denominator_value / value.denominator()));
+    return rational_errc();
+  }
+
+  type numerator_;
+};
+
+// Arithmetic operators.
+template <integral type, type denominator, overflow_policy policy>
+constexpr fixed_rational<type, denominator, policy> operator+ (const fixed_rational<type, denominator, policy>& lhs, const fixed_rational<type, denominator, policy>& rhs)
+{
+  fixed_rational<type, denominator, policy> result(lhs);
+  return result += rhs;
+}
+template <integral type, type denominator, overflow_policy policy>
+constexpr fixed_rational<type, denominator, policy> operator- (const fixed_rational<type, denominator, policy>& lhs, const fixed_rational<type, denominator, policy>& rhs)
+{
+  fixed_rational<type, denominator, policy> result(lhs);
+  return result -= rhs;
+}
+template <integral type, type denominator, overflow_policy policy>
+constexpr fixed_rational<type, denominator, policy> operator* (const fixed_rational<type, denominator, policy>& lhs, const type&                                      rhs)
+{
+  fixed_rational<type, denominator, policy> result(lhs);
+  return result *= rhs;
+}
+template <integral type, type denominator, overflow_policy policy>
+constexpr fixed_rational<type, denominator, policy> operator* (const type&                                      lhs, const fixed_rational<type, denominator, policy>& rhs)
+{
+  fixed_rational<type, denominator, policy> result(rhs);
+  return result *= lhs;
+}
+
+// Stream operators (the canonical value, as rational).
+template <typename char_type, typename traits, integral type, type denominator, overflow_policy policy>
+std::basic_ostream<char_type, traits>&              operator<<(std::basic_ostream<char_type, traits>& stream, const fixed_rational<type, denominator, policy>& value)
+{
+  return stream << static_cast<rational<type, policy>>(value);
+}
+
+// The value of a std::ratio as a rational (canonical, as std::ratio is), whose numerator and denominator fit the integer type.
+template <typename ratio_type, integral type = std::intmax_t, overflow_policy policy = unchecked_policy>
+requires (detail::scaled_in_range<type>(ratio_type::num, 1) && detail::scaled_in_range<type>(ratio_type::den, 1))
+constexpr rational<type, policy> to_rational()
+{
+  return rational<type, policy>(static_cast<type>(ratio_type::num), static_cast<type>(ratio_type::den));
+}
+}
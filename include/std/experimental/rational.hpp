@@ -1,12 +1,33 @@
 #pragma once
 
+#include <bit>
+#include <charconv>
 #include <cmath>
 #include <compare>
+#include <concepts>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <numeric>
 #include <stdexcept>
+#include <system_error>
 #include <type_traits>
+#include <utility>
+
+#if __has_include(<expected>)
+#include <expected>
+#endif
+#if __has_include(<format>)
+#include <format>
+#endif
+
+// Exceptions are disabled automatically with -fno-exceptions (or /EHs-c-), or explicitly by defining RATIONAL_NO_EXCEPTIONS. Errors of
+// the throwing interface then terminate the program, and the exception-free interface (make, try_*) should be used instead.
+#if !defined(RATIONAL_NO_EXCEPTIONS) && !defined(__cpp_exceptions) && !defined(__EXCEPTIONS) && !defined(_CPPUNWIND)
+#define RATIONAL_NO_EXCEPTIONS
+#endif
 
 namespace std::experimental
 {
@@ -16,14 +37,1020 @@ concept arithmetic     = std::is_arithmetic_v    <type>;
 template <typename type>
 concept floating_point = std::is_floating_point_v<type>;
 template <typename type>
-concept integral       = std::is_integral_v      <type>;
+concept integral       = std::is_integral_v      <type> || (std::numeric_limits<type>::is_integer && !std::numeric_limits<type>::is_bounded);
+// Unbounded integral types are arbitrary-precision integers (e.g. big_integer of big_integer.hpp, or an adapter of GMP's mpz_t), i.e.
+// class types specializing std::numeric_limits with is_integer and without is_bounded. They provide the arithmetic, comparison and
+// stream operators, and gcd (found by argument-dependent lookup). Their arithmetic does not overflow, and the overflow policies have
+// no effect on it. The floating point conversions of rational additionally require the shift operators, a bit_width member and the
+// conversions from and to built-in integers, and are exact from floating point (approximate with a tolerance requires a bounded type).
+
+// Error codes of the exception-free interface.
+enum class rational_errc
+{
+  zero_denominator = 1, // Denominator can not be zero.
+  division_by_zero    , // Division by zero.
+  not_finite          , // Value can not be infinite or NaN.
+  underflow           , // Value evaluates to zero due to being too small.
+  overflow            , // Arithmetic overflow.
+  not_representable     // Value can not be represented with the fixed denominator (see fixed_rational.hpp).
+};
+
+// Tag of the constructor of rational from a numerator and a denominator already in canonical form, which skips the gcd.
+struct canonical_t
+{
+  explicit canonical_t() = default;
+};
+inline constexpr canonical_t canonical {};
+
+namespace detail
+{
+// Throws the exception corresponding to the error code, or terminates if exceptions are disabled.
+[[noreturn]] inline void throw_error(const rational_errc error)
+{
+#if defined(RATIONAL_NO_EXCEPTIONS)
+  static_cast<void>(error);
+  std::abort();
+#else
+  switch (error)
+  {
+  case rational_errc::zero_denominator : throw std::domain_error  ("Denominator can not be zero.");
+  case rational_errc::division_by_zero : throw std::domain_error  ("Division by zero.");
+  case rational_errc::not_finite       : throw std::domain_error  ("Value can not be infinite.");
+  case rational_errc::underflow        : throw std::domain_error  ("Value evaluates to zero due to being too small.");
+  case rational_errc::not_representable: throw std::domain_error  ("Value can not be represented with the fixed denominator.");
+  default                              : throw std::overflow_error("Arithmetic overflow.");
+  }
+#endif
+}
+
+// Number of trailing zero bits of a non-zero unsigned integer, including integers wider than the standard ones (e.g. unsigned __int128).
+template <typename type>
+constexpr int  countr_zero(const type value)
+{
+  if constexpr (sizeof(type) <= sizeof(unsigned long long))
+    return std::countr_zero(static_cast<unsigned long long>(value));
+  else
+  {
+    constexpr auto digits = std::numeric_limits<unsigned long long>::digits;
+    const     auto low    = static_cast<unsigned long long>(value);
+    return low != 0ull ? std::countr_zero(low) : digits + detail::countr_zero(static_cast<type>(value >> digits));
+  }
+}
+
+// Number of bits required to represent an unsigned integer, including integers wider than the standard ones, and unbounded integers
+// that provide it as a member (as big_integer).
+template <typename type>
+constexpr int  bit_width  (const type& value)
+{
+  if constexpr (!std::numeric_limits<type>::is_bounded)
+    return static_cast<int>(value.bit_width());
+  else if constexpr (sizeof(type) <= sizeof(unsigned long long))
+    return std::bit_width(static_cast<unsigned long long>(value));
+  else
+  {
+    constexpr auto digits = std::numeric_limits<unsigned long long>::digits;
+    const     auto high   = static_cast<type>(value >> digits);
+    return high != type(0) ? digits + detail::bit_width(high) : std::bit_width(static_cast<unsigned long long>(value));
+  }
+}
+
+// Absolute value of an integer as its unsigned counterpart (well-defined for the minimum of signed types).
+template <integral type>
+constexpr auto uabs       (const type& value)
+{
+  if constexpr (!std::numeric_limits<type>::is_bounded)
+    return type(0) > value ? type(-value) : value;
+  else
+  {
+    using unsigned_type = std::make_unsigned_t<type>;
+    return type(0) > value ? static_cast<unsigned_type>(unsigned_type(0) - static_cast<unsigned_type>(value)) : static_cast<unsigned_type>(value);
+  }
+}
+
+// Binary (Stein's) gcd of unsigned integers. Replaces divisions by shifts and subtractions, and strips all trailing zeros at once.
+template <typename type>
+constexpr type binary_gcd (type lhs, type rhs)
+{
+  if (lhs == type(0))
+    return rhs;
+  if (rhs == type(0))
+    return lhs;
+
+  const auto shift = detail::countr_zero(static_cast<type>(lhs | rhs));
+  lhs >>= detail::countr_zero(lhs);
+  do
+  {
+    rhs >>= detail::countr_zero(rhs);
+    const auto minimum = lhs < rhs ? lhs : rhs; // Branchless (conditional moves) as the comparison is unpredictable.
+    rhs  = static_cast<type>((lhs < rhs ? rhs : lhs) - minimum);
+    lhs  = minimum;
+  } while (rhs != type(0));
+  return static_cast<type>(lhs << shift);
+}
+
+// Hybrid Euclid/binary gcd of unsigned integers. A single division first brings operands of very different magnitude to the same
+// size, where the binary gcd takes over. Favorable when a subtraction step is expensive in comparison to a division.
+template <typename type>
+constexpr type hybrid_gcd (type lhs, type rhs)
+{
+  if (lhs < rhs)
+    std::swap(lhs, rhs);
+  if (rhs == type(0))
+    return lhs;
+  return detail::binary_gcd(static_cast<type>(lhs % rhs), rhs);
+}
+
+// Lehmer's gcd of unsigned integers wider than a machine word (see Knuth TAOCP Vol. 2, 4.5.2, Algorithm L). The Euclidean quotients 
+// are simulated on the leading word of the operands with single-word arithmetic until Collins' condition can no longer guarantee 
+// them to be exact, and the accumulated cofactors are then applied to the full-width values at once. This replaces most multi-word
+// divisions by a few multi-word multiplications.
+template <typename type>
+constexpr type lehmer_gcd (type lhs, type rhs)
+{
+  using word = unsigned long long;
+
+  if (lhs < rhs)
+    std::swap(lhs, rhs);
+
+  while (rhs > static_cast<type>(std::numeric_limits<word>::max()))
+  {
+    // Simulate the Euclidean algorithm on the leading words. The cofactors are unsigned with alternating signs.
+    const auto shift = detail::bit_width(lhs) - std::numeric_limits<word>::digits;
+    auto x = static_cast<word>(lhs >> shift);
+    auto y = static_cast<word>(rhs >> shift);
+    word u0(0), u1(1), u2(0);
+    word v0(0), v1(0), v2(1);
+    auto even = false;
+    while (y >= v2 && x - y >= v1 + v2)
+    {
+      const auto quotient = x / y;
+      const auto u        = u1 + quotient * u2;
+      const auto v        = v1 + quotient * v2;
+      x    = std::exchange(y, x - quotient * y);
+      u0   = std::exchange(u1, std::exchange(u2, u));
+      v0   = std::exchange(v1, std::exchange(v2, v));
+      even = !even;
+    }
+
+    if (v0 == word(0))
+      lhs = std::exchange(rhs, static_cast<type>(lhs % rhs));
+    else
+    {
+      // Wrap-around arithmetic is exact since the results are known to lie within [0, lhs].
+      const auto next = even ? static_cast<type>(u0 * lhs - v0 * rhs) : static_cast<type>(v0 * rhs - u0 * lhs);
+      rhs             = even ? static_cast<type>(v1 * rhs - u1 * lhs) : static_cast<type>(u1 * lhs - v1 * rhs);
+      lhs             = next;
+    }
+  }
+
+  if (rhs == type(0))
+    return lhs;
+  return static_cast<type>(detail::binary_gcd(static_cast<word>(rhs), static_cast<word>(lhs % rhs)));
+}
+
+namespace adl
+{
+void gcd() = delete; // Hides detail::gcd from the unqualified call below, which finds the gcd of the integer type by argument-dependent lookup.
+
+template <typename type>
+constexpr type unbounded_gcd(const type& lhs, const type& rhs)
+{
+  return static_cast<type>(gcd(lhs, rhs));
+}
+}
+
+// Greatest common divisor, with semantics identical to std::gcd. The kernel is selected per integer width at compile time, unbounded
+// integers provide their own.
+template <integral type>
+constexpr type gcd        (const type& lhs, const type& rhs)
+{
+  if constexpr (!std::numeric_limits<type>::is_bounded)
+    return adl::unbounded_gcd(lhs, rhs);
+  else if constexpr (sizeof(type) <= sizeof(unsigned long long))
+    return static_cast<type>(detail::binary_gcd(detail::uabs(lhs), detail::uabs(rhs)));
+  else
+    return static_cast<type>(detail::lehmer_gcd(detail::uabs(lhs), detail::uabs(rhs)));
+}
+
+// Overflow-detecting arithmetic. Returns true if the result has wrapped around (which unbounded integers never do).
+template <integral type>
+constexpr bool add_overflow     (const type lhs, const type rhs, type& result)
+{
+  if constexpr (!std::numeric_limits<type>::is_bounded)
+  {
+    result = lhs + rhs;
+    return false;
+  }
+  else
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_add_overflow(lhs, rhs, &result);
+#else
+    using unsigned_type = std::make_unsigned_t<type>;
+    result = static_cast<type>(static_cast<unsigned_type>(lhs) + static_cast<unsigned_type>(rhs));
+    if constexpr (std::is_signed_v<type>)
+      return (lhs >= type(0)) == (rhs >= type(0)) && (result >= type(0)) != (lhs >= type(0));
+    else
+      return result < lhs;
+#endif
+  }
+}
+template <integral type>
+constexpr bool subtract_overflow(const type lhs, const type rhs, type& result)
+{
+  if constexpr (!std::numeric_limits<type>::is_bounded)
+  {
+    result = lhs - rhs;
+    return false;
+  }
+  else
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_sub_overflow(lhs, rhs, &result);
+#else
+    using unsigned_type = std::make_unsigned_t<type>;
+    result = static_cast<type>(static_cast<unsigned_type>(lhs) - static_cast<unsigned_type>(rhs));
+    if constexpr (std::is_signed_v<type>)
+      return (lhs >= type(0)) != (rhs >= type(0)) && (result >= type(0)) != (lhs >= type(0));
+    else
+      return rhs > lhs;
+#endif
+  }
+}
+template <integral type>
+constexpr bool multiply_overflow(const type lhs, const type rhs, type& result)
+{
+  if constexpr (!std::numeric_limits<type>::is_bounded)
+  {
+    result = lhs * rhs;
+    return false;
+  }
+  else
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_mul_overflow(lhs, rhs, &result);
+#else
+    using unsigned_type = std::make_unsigned_t<type>;
+    const auto magnitude = static_cast<unsigned_type>(detail::uabs(lhs) * detail::uabs(rhs));
+    const auto negative  = (lhs < type(0)) != (rhs < type(0));
+    result = static_cast<type>(negative ? unsigned_type(0) - magnitude : magnitude);
+    if (lhs == type(0) || rhs == type(0))
+      return false;
+    if (magnitude / detail::uabs(lhs) != detail::uabs(rhs))
+      return true;
+    if constexpr (std::is_signed_v<type>)
+      return magnitude > static_cast<unsigned_type>(std::numeric_limits<type>::max()) + (negative ? 1u : 0u);
+    else
+      return false;
+#endif
+  }
+}
+
+// The integer type of twice the width (where available, otherwise the type itself).
+template <integral integral_type>
+struct wider
+{
+  using type = integral_type;
+};
+template <integral integral_type> requires (std::is_integral_v<integral_type> && sizeof(integral_type) <= sizeof(std::int32_t))
+struct wider<integral_type>
+{
+  using type = std::conditional_t<std::is_signed_v<integral_type>, std::int64_t, std::uint64_t>;
+};
+#if defined(__SIZEOF_INT128__)
+template <integral integral_type> requires (std::is_integral_v<integral_type> && sizeof(integral_type) == sizeof(std::int64_t))
+struct wider<integral_type>
+{
+  using type = std::conditional_t<std::is_signed_v<integral_type>, __int128, unsigned __int128>;
+};
+#endif
+template <integral integral_type>
+using wider_t = typename wider<integral_type>::type;
+
+// The unsigned integer type of the same width (the type itself for unbounded integers, whose magnitudes are non-negative values of it).
+template <integral integral_type>
+struct make_unsigned
+{
+  using type = integral_type;
+};
+template <integral integral_type> requires (std::is_integral_v<integral_type>)
+struct make_unsigned<integral_type>
+{
+  using type = std::make_unsigned_t<integral_type>;
+};
+template <integral integral_type>
+using make_unsigned_t = typename make_unsigned<integral_type>::type;
+
+// Floor division with a non-negative remainder for a positive divisor.
+template <integral type>
+constexpr void floor_divide     (const type& dividend, const type& divisor, type& quotient, type& remainder)
+{
+  quotient  = dividend / divisor;
+  remainder = dividend % divisor;
+  if constexpr (std::numeric_limits<type>::is_signed)
+    if (remainder < type(0))
+    {
+      quotient  -= type(1);
+      remainder += divisor;
+    }
+}
+
+// Compares a/b with c/d for positive b and d without overflow. Uses a branch-free widening multiplication where a wider type is 
+// available, otherwise compares the continued fraction expansions term by term (the ordering flips with each reciprocal), after a 
+// shortcut for the common case of equal denominators. Unbounded integers compare the products directly.
+template <integral type>
+constexpr std::strong_ordering compare_fractions(type a, type b, type c, type d)
+{
+  if constexpr (!std::numeric_limits<type>::is_bounded)
+    return a * d <=> b * c;
+  else if constexpr (sizeof(wider_t<type>) > sizeof(type))
+    return static_cast<wider_t<type>>(a) * d <=> static_cast<wider_t<type>>(b) * c;
+  else
+  {
+    if (b == d)
+      return a <=> c;
+
+    auto flipped = false;
+    while (true)
+    {
+      type lhs_quotient, lhs_remainder, rhs_quotient, rhs_remainder;
+      detail::floor_divide(a, b, lhs_quotient, lhs_remainder);
+      detail::floor_divide(c, d, rhs_quotient, rhs_remainder);
+
+      if (lhs_quotient != rhs_quotient || lhs_remainder == type(0) || rhs_remainder == type(0))
+      {
+        // Either the integer parts differ, or at least one of the fractional parts is zero.
+        const auto result = lhs_quotient != rhs_quotient ? lhs_quotient <=> rhs_quotient : lhs_remainder <=> rhs_remainder;
+        return flipped ? 0 <=> result : result;
+      }
+
+      // r1/b < r2/d iff b/r1 > d/r2.
+      a = std::exchange(b, lhs_remainder);
+      c = std::exchange(d, rhs_remainder);
+      flipped = !flipped;
+    }
+  }
+}
+
+// Compares a/b with c for positive b without overflow.
+template <integral type>
+constexpr std::strong_ordering compare_fraction (const type& a, const type& b, const type& c)
+{
+  // a/b < c iff floor(a/b) < c, or floor(a/b) == c and the remainder is zero.
+  type quotient, remainder;
+  detail::floor_divide(a, b, quotient, remainder);
+  return quotient != c ? quotient <=> c : remainder <=> type(0);
+}
+
+
+// Multiplies a floating point value by 2^exponent. Exact as long as the result is representable.
+template <floating_point type>
+constexpr type scale_binary     (type value, int exponent)
+{
+  constexpr auto chunk = static_cast<type>(1ull << 32);
+  for (; exponent >=  32; exponent -= 32)
+    value *= chunk;
+  for (; exponent <= -32; exponent += 32)
+    value /= chunk;
+  return exponent >= 0 ? value * static_cast<type>(1ull << exponent) : value / static_cast<type>(1ull << -exponent);
+}
+
+// Rounds (-1)^negative * (mantissa + sticky) * 2^exponent to the floating point type, where sticky denotes a non-zero remainder 
+// below the least significant bit of the mantissa. Subnormal results are rounded at their reduced precision.
+template <floating_point result_type, typename word>
+constexpr result_type round_binary(const bool negative, word mantissa, int exponent, bool sticky, const std::float_round_style style)
+{
+  constexpr auto digits       = std::numeric_limits<result_type>::digits;
+  constexpr auto min_exponent = std::numeric_limits<result_type>::min_exponent;
+
+  const auto width     = detail::bit_width(mantissa);
+  const auto leading   = width - 1 + exponent;
+  const auto precision = leading < min_exponent - 1 ? digits - (min_exponent - 1 - leading) : digits;
+  const auto drop      = width - precision;
+
+  auto round = false;
+  if      (drop >= width)
+  {
+    round    = drop == width && ((mantissa >> (width - 1)) & word(1)) != word(0);
+    sticky   = sticky || (drop == width ? mantissa != (word(1) << (width - 1)) : mantissa != word(0));
+    mantissa = word(0);
+    exponent += drop;
+  }
+  else if (drop > 0)
+  {
+    round    = ((mantissa >> (drop - 1)) & word(1)) != word(0);
+    sticky   = sticky || (mantissa & ((word(1) << (drop - 1)) - word(1))) != word(0);
+    mantissa >>= drop;
+    exponent  += drop;
+  }
+
+  auto increment = false;
+  switch (style)
+  {
+  case std::round_toward_zero         : increment = false; break;
+  case std::round_toward_infinity     : increment = !negative && (round || sticky); break;
+  case std::round_toward_neg_infinity : increment =  negative && (round || sticky); break;
+  default                             : increment = round && (sticky || (mantissa & word(1)) != word(0)); break;
+  }
+  mantissa += static_cast<word>(increment);
+
+  const auto result = detail::scale_binary(static_cast<result_type>(mantissa), exponent);
+  return negative ? -result : result;
+}
+
+// Converts the fraction a/b (b > 0) to the closest floating point value in the given rounding direction, without double rounding.
+template <floating_point result_type, integral type>
+constexpr result_type to_floating_point(const type a, const type b, const std::float_round_style style)
+{
+  using unsigned_type = detail::make_unsigned_t<type>;
+
+  constexpr auto digits    = std::numeric_limits<result_type>::digits;
+  constexpr auto precision = digits + 2; // The mantissa, a rounding bit and a bit of slack from the quotient's width.
+
+  if (a == type(0))
+    return result_type(0);
+
+  const auto negative  = type(0) > a;
+  const auto dividend  = detail::uabs(a);
+  const auto divisor   = static_cast<unsigned_type>(b);
+
+  // Both operands are exact in the floating point type, the hardware division is correctly rounded to nearest.
+  if constexpr (digits < std::numeric_limits<unsigned_type>::digits)
+  {
+    if (style == std::round_to_nearest && dividend >> digits == unsigned_type(0) && divisor >> digits == unsigned_type(0))
+    {
+      const auto result = static_cast<result_type>(dividend) / static_cast<result_type>(divisor);
+      return negative ? -result : result;
+    }
+  }
+  else if (style == std::round_to_nearest)
+  {
+    const auto result = static_cast<result_type>(dividend) / static_cast<result_type>(divisor);
+    return negative ? -result : result;
+  }
+
+  if constexpr (sizeof(unsigned_type) <= sizeof(std::uint64_t) && sizeof(wider_t<std::uint64_t>) > sizeof(std::uint64_t) && precision < 64)
+  {
+    // A single wide division yields a quotient of precision or precision + 1 bits.
+    using wide_type = wider_t<std::uint64_t>;
+    const auto shift = precision - (detail::bit_width(dividend) - detail::bit_width(divisor));
+    auto wide_dividend = static_cast<wide_type>(dividend);
+    auto wide_divisor  = static_cast<wide_type>(divisor );
+    if (shift >= 0)
+      wide_dividend <<=  shift;
+    else
+      wide_divisor  <<= -shift;
+    const auto quotient = wide_dividend / wide_divisor; // The remainder is recovered by a multiplication rather than a second division.
+    return detail::round_binary<result_type>(negative, quotient, -shift, quotient * wide_divisor != wide_dividend, style);
+  }
+  else
+  {
+    // Long division, one bit at a time (after skipping the leading zero bits of a fractional quotient).
+    using quotient_type = std::conditional_t<(sizeof(unsigned_type) > sizeof(std::uint64_t)), unsigned_type, wider_t<std::uint64_t>>;
+    auto quotient  = static_cast<quotient_type>(dividend / divisor);
+    auto remainder = static_cast<unsigned_type>(dividend % divisor);
+    auto exponent  = 0;
+    if (quotient == quotient_type(0))
+    {
+      const auto skip = detail::bit_width(divisor) - detail::bit_width(remainder) - 1;
+      if (skip > 0)
+      {
+        remainder <<= skip;
+        exponent   -= skip;
+      }
+    }
+    while (detail::bit_width(quotient) < precision)
+    {
+      // 2r >= b iff r >= b - r, which can not overflow.
+      const auto bit = remainder >= divisor - remainder;
+      remainder = bit ? static_cast<unsigned_type>(remainder - (divisor - remainder)) : static_cast<unsigned_type>(remainder << 1);
+      quotient  = static_cast<quotient_type>((quotient << 1) | quotient_type(bit));
+      --exponent;
+    }
+    return detail::round_binary<result_type>(negative, quotient, exponent, remainder != unsigned_type(0), style);
+  }
+}
+// Unbounded integers scale the magnitude of the dividend or the divisor to a quotient of precision or precision + 1 bits, which is 
+// then rounded in a built-in integer.
+template <floating_point result_type, integral type> requires (!std::numeric_limits<type>::is_bounded)
+constexpr result_type to_floating_point(const type a, const type b, const std::float_round_style style)
+{
+  constexpr auto precision = std::numeric_limits<result_type>::digits + 2;
+  using word = std::conditional_t<(precision < std::numeric_limits<std::uint64_t>::digits), std::uint64_t, wider_t<std::uint64_t>>;
+  static_assert(precision < std::numeric_limits<word>::digits, "The quotient must fit into a built-in integer.");
+
+  if (a == type(0))
+    return result_type(0);
+
+  const auto negative = type(0) > a;
+  auto       dividend = detail::uabs(a);
+  auto       divisor  = b;
+  const auto shift    = precision - (detail::bit_width(dividend) - detail::bit_width(divisor));
+  if (shift >= 0)
+    dividend <<=  shift;
+  else
+    divisor  <<= -shift;
+  const auto quotient = dividend / divisor;
+  return detail::round_binary<result_type>(negative, static_cast<word>(quotient), -shift, quotient * divisor != dividend, style);
+}
+
+// Best rational approximation p/q of n/d with q <= maximum < d, by continued fractions (as Python's Fraction.limit_denominator). The
+// convergents are bounded by n/d, hence can not overflow. The result is the last convergent within the bound or the semiconvergent
+// beyond it, whichever is closer to n/d (the convergent on a tie).
+template <typename type>
+constexpr void limit_denominator(type n, type d, const type maximum, type& p, type& q)
+{
+  type p0(0), q0(1), p1(1), q1(0);
+  while (true)
+  {
+    const auto term   = static_cast<type>(n / d);
+    const auto next_q = static_cast<type>(q0 + term * q1);
+    if (next_q > maximum)
+      break;
+    p0 = std::exchange(p1, static_cast<type>(p0 + term * p1));
+    q0 = std::exchange(q1, next_q);
+    n  = std::exchange(d , static_cast<type>(n - term * d));
+  }
+
+  // The distances of the convergent and of the semiconvergent to n/d are proportional to d/q1 and (n - k d)/(q0 + k q1).
+  const auto k = static_cast<type>((maximum - q0) / q1);
+  const auto semiconvergent_p = static_cast<type>(p0 + k * p1);
+  const auto semiconvergent_q = static_cast<type>(q0 + k * q1);
+  if (detail::compare_fractions(d, q1, static_cast<type>(n - k * d), semiconvergent_q) <= 0)
+  {
+    p = p1;
+    q = q1;
+  }
+  else
+  {
+    p = semiconvergent_p;
+    q = semiconvergent_q;
+  }
+}
+
+// Parses decimal digits into an unsigned integer. Returns the end of the digits, all of which are consumed even if the value overflows.
+template <typename type>
+constexpr const char* parse_digits(const char* first, const char* last, type& value, bool& overflow)
+{
+  value = type(0);
+  for (; first != last && *first >= '0' && *first <= '9'; ++first)
+    overflow |= detail::multiply_overflow(value, type(10), value) || detail::add_overflow(value, static_cast<type>(*first - '0'), value);
+  return first;
+}
+
+// Writes the first count digits of the decimal expansion of remainder/divisor (remainder < divisor) by long division.
+template <typename output_iterator, typename type>
+constexpr output_iterator write_fraction_digits(output_iterator output, type remainder, const type divisor, std::size_t count)
+{
+  for (; count != 0; --count)
+  {
+    auto digit = 0;
+    if constexpr (sizeof(wider_t<type>) > sizeof(type))
+    {
+      const auto scaled = static_cast<wider_t<type>>(remainder) * 10;
+      digit     = static_cast<int >(scaled / divisor);
+      remainder = static_cast<type>(scaled % divisor);
+    }
+    else
+    {
+      // 10 r mod d by repeated addition, as 10 r may overflow. Neither r + r nor the comparison can, since r < d.
+      auto scaled = type(0);
+      for (auto i = 0; i < 10; ++i)
+      {
+        if (scaled >= divisor - remainder)
+        {
+          scaled = static_cast<type>(scaled - (divisor - remainder));
+          ++digit;
+        }
+        else
+          scaled = static_cast<type>(scaled + remainder);
+      }
+      remainder = scaled;
+    }
+    *output++ = static_cast<char>('0' + digit);
+  }
+  return output;
+}
+
+// The format specification of the integers of a rational, the integer std-format-spec without fill, alignment and sign: [#][0][width][type]
+// - #            : The prefix of the base (0b, 0B, 0, 0x or 0X).
+// - 0, width     : The minimum width of the integer including its prefix, padded with zeros after the prefix if 0 is given, else with
+//                  spaces in front.
+// - type         : The base, b, B, o, x, X or d (the default).
+struct integer_format_specification
+{
+  bool        alternate = false;
+  bool        zero      = false;
+  std::size_t width     = 0;
+  int         base      = 10;
+  bool        uppercase = false;
+};
+
+// The format specification of rationals (see std::formatter), independent of <format>: [[fill]align][sign][width][style][:integer[/integer]]
+// - fill, align  : The fill character (a space by default) and the alignment (<, ^ or >, the default) of the whole result.
+// - sign         : - (negative values only, the default), + (all values) or a space (a space for non-negative values).
+// - width        : The minimum width of the whole result.
+// - style        : f (fraction, "3/2", default), m (mixed number, "1 1/2"), or .N (decimal with N digits, truncated, "1.50" for .2).
+//                  The decimal digits are computed exactly by long division, not through a floating point type.
+// - integer      : The integer_format_specification of the numerator (and the whole part), and of the denominator, which is the one
+//                  of the numerator unless given.
+// The sign is written once, in front of the magnitudes of the integers.
+template <typename char_type>
+struct format_specification
+{
+  enum class style_type { fraction, mixed, decimal };
+
+  char_type                    fill        = char_type(' ');
+  char                         align       = '>';
+  char                         sign        = '-';
+  std::size_t                  width       = 0;
+  style_type                   style       = style_type::fraction;
+  std::size_t                  precision   = 0;
+  integer_format_specification numerator   {};
+  integer_format_specification denominator {};
+};
+
+// Parses a format specification up to the closing brace (or the end). Returns false if it is invalid.
+template <typename iterator, typename char_type>
+constexpr bool parse_format_specification(iterator& current, const iterator last, format_specification<char_type>& specification)
+{
+  const auto is_align = [ ] (const char_type value) { return value == char_type('<') || value == char_type('^') || value == char_type('>'); };
+  const auto is_digit = [ ] (const char_type value) { return value >= char_type('0') && value <= char_type('9'); };
+  const auto parse_number = [&] (std::size_t& value)
+  {
+    for (value = 0; current != last && is_digit(*current); ++current)
+      value = value * 10 + static_cast<std::size_t>(*current - char_type('0'));
+  };
+
+  if      (current != last && std::next(current) != last && is_align(*std::next(current)) && *current != char_type('{') && *current != char_type('}'))
+  {
+    specification.fill  = *current++;
+    specification.align = static_cast<char>(*current++);
+  }
+  else if (current != last && is_align(*current))
+    specification.align = static_cast<char>(*current++);
+
+  if (current != last && (*current == char_type('-') || *current == char_type('+') || *current == char_type(' ')))
+    specification.sign = static_cast<char>(*current++);
+
+  if (current != last && is_digit(*current) && *current != char_type('0'))
+    parse_number(specification.width);
+
+  if      (current != last && *current == char_type('f'))
+  {
+    specification.style = format_specification<char_type>::style_type::fraction;
+    ++current;
+  }
+  else if (current != last && *current == char_type('m'))
+  {
+    specification.style = format_specification<char_type>::style_type::mixed;
+    ++current;
+  }
+  else if (current != last && *current == char_type('.'))
+  {
+    specification.style = format_specification<char_type>::style_type::decimal;
+    if (++current == last || !is_digit(*current))
+      return false;
+    parse_number(specification.precision);
+  }
+
+  const auto parse_integer = [&] (integer_format_specification& integer)
+  {
+    if (current != last && *current == char_type('#'))
+    {
+      integer.alternate = true;
+      ++current;
+    }
+    if (current != last && *current == char_type('0'))
+    {
+      integer.zero = true;
+      ++current;
+    }
+    if (current != last && is_digit(*current) && *current != char_type('0'))
+      parse_number(integer.width);
+    if (current != last && *current != char_type('/') && *current != char_type('}'))
+    {
+      switch (*current++)
+      {
+      case char_type('b'): integer.base =  2;                           break;
+      case char_type('B'): integer.base =  2; integer.uppercase = true; break;
+      case char_type('o'): integer.base =  8;                           break;
+      case char_type('x'): integer.base = 16;                           break;
+      case char_type('X'): integer.base = 16; integer.uppercase = true; break;
+      case char_type('d'): integer.base = 10;                           break;
+      default            : return false;
+      }
+    }
+    return true;
+  };
+
+  if (current != last && *current == char_type(':'))
+  {
+    ++current;
+    if (!parse_integer(specification.numerator))
+      return false;
+    specification.denominator = specification.numerator;
+    if (current != last && *current == char_type('/'))
+    {
+      specification.denominator = integer_format_specification {};
+      ++current;
+      if (!parse_integer(specification.denominator))
+        return false;
+    }
+  }
+
+  return current == last || *current == char_type('}');
+}
+
+// Writes an unsigned integer according to the specification.
+template <typename char_type, typename output_iterator, typename type>
+constexpr output_iterator write_integer(output_iterator output, const type value, const integer_format_specification& specification)
+{
+  char digits[std::numeric_limits<type>::digits];
+  const auto end     = std::to_chars(digits, digits + sizeof(digits), value, specification.base).ptr;
+  const auto prefix  = !specification.alternate || specification.base == 10 || (specification.base == 8 && value == type(0)) ? std::size_t(0) : specification.base == 8 ? std::size_t(1) : std::size_t(2);
+  const auto length  = prefix + static_cast<std::size_t>(end - digits);
+  const auto padding = specification.width > length ? specification.width - length : std::size_t(0);
+
+  if (!specification.zero)
+    for (auto i = std::size_t(0); i < padding; ++i)
+      *output++ = char_type(' ');
+  if (prefix != 0)
+  {
+    *output++ = char_type('0');
+    if (prefix == 2)
+      *output++ = char_type(specification.base == 2 ? (specification.uppercase ? 'B' : 'b') : (specification.uppercase ? 'X' : 'x'));
+  }
+  if (specification.zero)
+    for (auto i = std::size_t(0); i < padding; ++i)
+      *output++ = char_type('0');
+  for (auto current = digits; current != end; ++current)
+    *output++ = char_type(specification.uppercase && *current >= 'a' ? *current - 'a' + 'A' : *current);
+  return output;
+}
+
+// Counts the characters written through it (and its copies).
+struct counting_iterator
+{
+  using difference_type = std::ptrdiff_t;
+
+  template <typename value_type>
+  constexpr counting_iterator& operator= (const value_type&) { ++*count; return *this; }
+  constexpr counting_iterator& operator* ()                  { return *this; }
+  constexpr counting_iterator& operator++()                  { return *this; }
+  constexpr counting_iterator  operator++(int)               { return *this; }
+
+  std::size_t* count;
+};
+
+// Writes numerator/denominator (denominator > 0) according to the specification.
+template <typename output_iterator, typename type, typename char_type>
+constexpr output_iterator format_rational(output_iterator output, const type numerator, const type denominator, const format_specification<char_type>& specification)
+{
+  using unsigned_type = std::make_unsigned_t<type>;
+  using style_type    = typename format_specification<char_type>::style_type;
+
+  const auto write = [&] <typename iterator> (iterator target)
+  {
+    if      (type(0) > numerator)
+      *target++ = char_type('-');
+    else if (specification.sign != '-')
+      *target++ = char_type(specification.sign);
+
+    const auto write_fraction = [&] (const unsigned_type lhs, const unsigned_type rhs)
+    {
+      target    = detail::write_integer<char_type>(target, lhs, specification.numerator  );
+      *target++ = char_type('/');
+      target    = detail::write_integer<char_type>(target, rhs, specification.denominator);
+    };
+
+    const auto magnitude = detail::uabs(numerator);
+    const auto divisor   = static_cast<unsigned_type>(denominator);
+    const auto whole     = static_cast<unsigned_type>(magnitude / divisor);
+    const auto remainder = static_cast<unsigned_type>(magnitude % divisor);
+    if      (specification.style == style_type::fraction)
+      write_fraction(magnitude, divisor);
+    else if (specification.style == style_type::mixed)
+    {
+      if      (remainder == unsigned_type(0))
+        target = detail::write_integer<char_type>(target, whole, specification.numerator);
+      else if (whole     == unsigned_type(0))
+        write_fraction(remainder, divisor);
+      else
+      {
+        target    = detail::write_integer<char_type>(target, whole, specification.numerator);
+        *target++ = char_type(' ');
+        write_fraction(remainder, divisor);
+      }
+    }
+    else
+    {
+      target = detail::write_integer<char_type>(target, whole, specification.numerator);
+      if (specification.precision != 0)
+      {
+        *target++ = char_type('.');
+        target    = detail::write_fraction_digits(target, remainder, divisor, specification.precision);
+      }
+    }
+    return target;
+  };
+
+  if (specification.width == 0)
+    return write(output);
+
+  // The result is written twice if padded, once to count its characters (which avoids a temporary string).
+  std::size_t length = 0;
+  write(counting_iterator {&length});
+  const auto padding = specification.width > length ? specification.width - length : std::size_t(0);
+  const auto before  = specification.align == '<' ? std::size_t(0) : specification.align == '^' ? padding / 2 : padding;
+  for (auto i = std::size_t(0); i < before; ++i)
+    *output++ = specification.fill;
+  output = write(output);
+  for (auto i = before; i < padding; ++i)
+    *output++ = specification.fill;
+  return output;
+}
+}
+
+// Overflow policies for rational arithmetic. A policy provides:
+// - intermediate<type>       : The integer type the operations are evaluated in.
+// - add, subtract, multiply  : The arithmetic primitives on the intermediate type.
+// - narrow<type>             : The conversion of a result from the intermediate type to the integer type of the rational.
+// - saturating               : Whether the primitives may clamp their results (which requires re-canonization).
+
+// Wraps around on overflow (undefined behavior for signed types). Fastest, identical to built-in integer arithmetic.
+struct unchecked_policy
+{
+  template <integral type>
+  using intermediate = type;
+
+  static constexpr bool saturating = false;
+
+  template <integral type>
+  static constexpr type add     (const type& lhs, const type& rhs)
+  {
+    return lhs + rhs;
+  }
+  template <integral type>
+  static constexpr type subtract(const type& lhs, const type& rhs)
+  {
+    return lhs - rhs;
+  }
+  template <integral type>
+  static constexpr type multiply(const type& lhs, const type& rhs)
+  {
+    return lhs * rhs;
+  }
+  template <integral type, integral intermediate_type>
+  static constexpr type narrow  (const intermediate_type& value)
+  {
+    return static_cast<type>(value);
+  }
+};
+
+// Throws std::overflow_error on overflow.
+struct checked_throw_policy
+{
+  template <integral type>
+  using intermediate = type;
+
+  static constexpr bool saturating = false;
+
+  template <integral type>
+  static constexpr type add     (const type& lhs, const type& rhs)
+  {
+    type result;
+    if (detail::add_overflow(lhs, rhs, result))
+      detail::throw_error(rational_errc::overflow);
+    return result;
+  }
+  template <integral type>
+  static constexpr type subtract(const type& lhs, const type& rhs)
+  {
+    type result;
+    if (detail::subtract_overflow(lhs, rhs, result))
+      detail::throw_error(rational_errc::overflow);
+    return result;
+  }
+  template <integral type>
+  static constexpr type multiply(const type& lhs, const type& rhs)
+  {
+    type result;
+    if (detail::multiply_overflow(lhs, rhs, result))
+      detail::throw_error(rational_errc::overflow);
+    return result;
+  }
+  template <integral type, integral intermediate_type>
+  static constexpr type narrow  (const intermediate_type& value)
+  {
+    if constexpr (std::is_same_v<type, intermediate_type>)
+      return value;
+    else if (!std::in_range<type>(value))
+      detail::throw_error(rational_errc::overflow);
+    return static_cast<type>(value);
+  }
+};
+
+// Evaluates the operations in the integer type of twice the width (where available) and clamps the numerator and the denominator of 
+// a result that does not fit to the limits of the integer type (as saturating integer arithmetic does), re-canonizing it. The value 
+// of a saturated result is an approximation.
+struct checked_saturate_policy
+{
+  template <integral type>
+  using intermediate = detail::wider_t<type>;
+
+  static constexpr bool saturating = true;
+
+  template <integral type>
+  static constexpr type add     (const type& lhs, const type& rhs)
+  {
+    type result;
+    if (detail::add_overflow(lhs, rhs, result))
+      return lhs < type(0) ? std::numeric_limits<type>::min() : std::numeric_limits<type>::max();
+    return result;
+  }
+  template <integral type>
+  static constexpr type subtract(const type& lhs, const type& rhs)
+  {
+    type result;
+    if (detail::subtract_overflow(lhs, rhs, result))
+      return rhs > type(0) ? std::numeric_limits<type>::min() : std::numeric_limits<type>::max();
+    return result;
+  }
+  template <integral type>
+  static constexpr type multiply(const type& lhs, const type& rhs)
+  {
+    type result;
+    if (detail::multiply_overflow(lhs, rhs, result))
+      return (lhs < type(0)) != (rhs < type(0)) ? std::numeric_limits<type>::min() : std::numeric_limits<type>::max();
+    return result;
+  }
+  template <integral type, integral intermediate_type>
+  static constexpr type narrow  (const intermediate_type& value)
+  {
+    if constexpr (std::is_same_v<type, intermediate_type>)
+      return value;
+    else
+    {
+      if (std::cmp_less   (value, std::numeric_limits<type>::min()))
+        return std::numeric_limits<type>::min();
+      if (std::cmp_greater(value, std::numeric_limits<type>::max()))
+        return std::numeric_limits<type>::max();
+      return static_cast<type>(value);
+    }
+  }
+};
+
+// Evaluates the operations in the integer type of twice the width (checked), and throws std::overflow_error only if the canonical 
+// result does not fit the integer type of the rational. Falls back to checked_throw_policy when no wider type is available.
+struct promote_policy
+{
+  template <integral type>
+  using intermediate = detail::wider_t<type>;
+
+  static constexpr bool saturating = false;
+
+  template <integral type>
+  static constexpr type add     (const type& lhs, const type& rhs)
+  {
+    return checked_throw_policy::add     (lhs, rhs);
+  }
+  template <integral type>
+  static constexpr type subtract(const type& lhs, const type& rhs)
+  {
+    return checked_throw_policy::subtract(lhs, rhs);
+  }
+  template <integral type>
+  static constexpr type multiply(const type& lhs, const type& rhs)
+  {
+    return checked_throw_policy::multiply(lhs, rhs);
+  }
+  template <integral type, integral intermediate_type>
+  static constexpr type narrow  (const intermediate_type& value)
+  {
+    return checked_throw_policy::narrow<type>(value);
+  }
+};
+
+template <typename type>
+concept overflow_policy = requires (int value)
+{
+  { type::template add     <int>(value, value) } -> std::same_as<int>;
+  { type::template subtract<int>(value, value) } -> std::same_as<int>;
+  { type::template multiply<int>(value, value) } -> std::same_as<int>;
+  { type::template narrow  <int>(value)        } -> std::same_as<int>;
+  { type::saturating                           } -> std::convertible_to<bool>;
+  typename type::template intermediate<int>;
+};
+
 
 // Limitations:
-// - The denominator can not be zero (throws std::domain_error).
+// - The denominator can not be zero (throws std::domain_error, or reports rational_errc::zero_denominator through make/try_*).
+// - Overflow is handled by the policy (see unchecked_policy, checked_throw_policy, checked_saturate_policy, promote_policy).
 // Furthermore the rational is kept in canonical form:
 // - The numerator and denominator are co-prime integers (have no common factors).
 // - Denominator is greater than zero.
-template <integral type>
+template <integral type, overflow_policy policy = unchecked_policy>
 class rational
 {
 public:
@@ -32,9 +1059,15 @@ public:
   : numerator_(numerator), denominator_(denominator)
   {
     if (denominator == type(0))
-      throw std::domain_error("Denominator can not be zero.");
+      detail::throw_error(rational_errc::zero_denominator);
 
     canonize();
+  }
+  // Trusted: The numerator and the denominator must be co-prime and the denominator positive, which is not checked.
+  constexpr rational         (canonical_t, const type& numerator, const type& denominator)
+  : numerator_(numerator), denominator_(denominator)
+  {
+
   }
   template <floating_point that_type>
   constexpr rational         (const that_type& that)
@@ -43,7 +1076,7 @@ public:
   }
   constexpr rational         (const rational&  that) = default;
   constexpr rational         (      rational&& temp) = default;
-  constexpr virtual ~rational()                      = default;
+  constexpr ~rational        ()                      = default;
 
   // Assignment operators.
   constexpr rational&            operator=  (const rational&  that) = default;
@@ -63,17 +1096,15 @@ public:
   }
   constexpr std::strong_ordering operator<=>(const rational&  that) const
   {
-    // a/b < c/d iff ad < bc.
-    if (*this == that)
-      return std::strong_ordering::equal;
-    return numerator_ * that.denominator_ <=> denominator_ * that.numerator_;
+    // a/b < c/d iff ad < bc (evaluated without overflow, in a single pass).
+    return detail::compare_fractions(numerator_, denominator_, that.numerator_, that.denominator_);
   }
   constexpr std::strong_ordering operator<=>(const type&      that) const
   {
-    // a/b < c/1 iff a < bc.
-    if (*this == that)
-      return std::strong_ordering::equal;
-    return numerator_ <=> denominator_ * that;
+    // a/b < c/1 iff a < bc (evaluated without overflow).
+    if (denominator_ == type(1))
+      return numerator_ <=> that;
+    return detail::compare_fraction(numerator_, denominator_, that);
   }
 
   // Unary arithmetic operators.
@@ -81,262 +1112,747 @@ public:
   {
     return {*this};
   }
+  // -a/b is canonical, unless the policy saturates the negation of the minimum (or the type is unsigned and wraps around).
   constexpr rational             operator-  () const
   {
-    return {-numerator_, denominator_};
+    rational result(*this);
+    result.numerator_ = negate(numerator_);
+    if constexpr (!std::numeric_limits<type>::is_signed)
+      result.canonize();
+    else if constexpr (policy::saturating && std::numeric_limits<type>::is_bounded)
+      if (result.numerator_ == std::numeric_limits<type>::max())
+        result.canonize();
+    return result;
   }
+  // b/a is canonical up to the sign.
   constexpr rational             operator~  () const
   {
-    return {denominator_, numerator_};
+    if (numerator_ == type(0))
+      detail::throw_error(rational_errc::zero_denominator);
+
+    rational result;
+    result.numerator_   = denominator_;
+    result.denominator_ = numerator_  ;
+    result.normalize_sign();
+    return result;
   }
 
   // Arithmetic assignment operators.
   constexpr rational&            operator+= (const rational&  that)
   {
-    // a / b + c / d = (ad + bc) / bd
-    numerator_   = numerator_   * that.denominator_ + denominator_ * that.numerator_;
-    denominator_ = denominator_ * that.denominator_;
-    canonize();
+    // a / b + c / d = (a(d/g) + c(b/g)) / (b/g)d where g = gcd(b, d) (Henrici, see Knuth TAOCP Vol. 2, 4.5.1).
+    const auto divisor = detail::gcd(denominator_, that.denominator_);
+    if (divisor == type(1))
+    {
+      // The result is already in canonical form.
+      assign_result(add(multiply(numerator_, that.denominator_), multiply(denominator_, that.numerator_)), multiply(denominator_, that.denominator_));
+      return *this;
+    }
+    add_reduced(add(multiply(numerator_, that.denominator_ / divisor), multiply(that.numerator_, denominator_ / divisor)), that.denominator_, divisor);
     return *this;
   }
   constexpr rational&            operator-= (const rational&  that)
   {
-    // a / b - c / d = (ad - bc) / bd
-    numerator_   = numerator_   * that.denominator_ - denominator_ * that.numerator_;
-    denominator_ = denominator_ * that.denominator_;
-    canonize();
+    // a / b - c / d = (a(d/g) - c(b/g)) / (b/g)d where g = gcd(b, d) (Henrici, see Knuth TAOCP Vol. 2, 4.5.1).
+    const auto divisor = detail::gcd(denominator_, that.denominator_);
+    if (divisor == type(1))
+    {
+      // The result is already in canonical form.
+      assign_result(subtract(multiply(numerator_, that.denominator_), multiply(denominator_, that.numerator_)), multiply(denominator_, that.denominator_));
+      return *this;
+    }
+    add_reduced(subtract(multiply(numerator_, that.denominator_ / divisor), multiply(that.numerator_, denominator_ / divisor)), that.denominator_, divisor);
     return *this;
   }
   constexpr rational&            operator*= (const rational&  that)
   {
-    // a / b * c / d = ac / bd
-    numerator_   *= that.numerator_  ;
-    denominator_ *= that.denominator_;
-    canonize();
+    // a / b * c / d = (a/g1)(c/g2) / (b/g2)(d/g1) where g1 = gcd(a, d) and g2 = gcd(c, b) (cross-cancellation).
+    const auto lhs_divisor = detail::gcd(numerator_     , that.denominator_);
+    const auto rhs_divisor = detail::gcd(that.numerator_, denominator_     );
+    assign_result(
+      multiply(numerator_   / lhs_divisor, that.numerator_   / rhs_divisor), 
+      multiply(denominator_ / rhs_divisor, that.denominator_ / lhs_divisor));
     return *this;
   }
   constexpr rational&            operator/= (const rational&  that)
   {
-    // a / b / c / d = ad / bc
+    // a / b / c / d = (a/g1)(d/g2) / (b/g2)(c/g1) where g1 = gcd(a, c) and g2 = gcd(d, b) (cross-cancellation).
     if (that.numerator_ == type(0))
-      throw std::domain_error("Division by zero.");
+      detail::throw_error(rational_errc::division_by_zero);
 
-    numerator_   *= that.denominator_;
-    denominator_ *= that.numerator_  ;
-    canonize();
+    const auto lhs_divisor = detail::gcd(numerator_       , that.numerator_);
+    const auto rhs_divisor = detail::gcd(that.denominator_, denominator_   );
+    assign_result(
+      multiply(numerator_   / lhs_divisor, that.denominator_ / rhs_divisor), 
+      multiply(denominator_ / rhs_divisor, that.numerator_   / lhs_divisor));
+    normalize_sign();
     return *this;
   }
   constexpr rational&            operator+= (const type&      that)
   {
     // a / b + c / 1 = (a + bc) / b
-    numerator_ += that * denominator_;
+    assign_result(add     (numerator_, multiply(that, denominator_)), denominator_);
     return *this;
   }
   constexpr rational&            operator-= (const type&      that)
   {
     // a / b - c / 1 = (a - bc) / b
-    numerator_ -= that * denominator_;
+    assign_result(subtract(numerator_, multiply(that, denominator_)), denominator_);
     return *this;
   }
   constexpr rational&            operator*= (const type&      that)
   {
-    // a / b * c / 1 = ac / b
-    numerator_ *= that;
-    canonize();
+    // a / b * c / 1 = a(c/g) / (b/g) where g = gcd(c, b) (cross-cancellation).
+    const auto divisor = detail::gcd(that, denominator_);
+    assign_result(multiply(numerator_, that / divisor), denominator_ / divisor);
     return *this;
   }
-  constexpr rational&            operator/= (const type&      that)
+  constexpr rational&            operator/= (const type&      that)
+  {
+    // a / b / c / 1 = (a/g) / b(c/g) where g = gcd(a, c) (cross-cancellation).
+    if (that == type(0))
+      detail::throw_error(rational_errc::division_by_zero);
+
+    const auto divisor = detail::gcd(numerator_, that);
+    assign_result(numerator_ / divisor, multiply(denominator_, that / divisor));
+    normalize_sign();
+    return *this;
+  }
+
+  // Fused multiply-add: Assigns this + x * w = p/q + n/d, where p/q is the cross-cancelled product, which is evaluated in the integer
+  // type of twice the width (where available) and added as in operator+= without being narrowed. The gcds and divisions are evaluated
+  // on the integer type of the rational where the intermediates fit it. Falls back to the separate operations (i.e. to the overflow
+  // policy) only if the wide intermediates or the canonical result overflow.
+  constexpr rational&            fma_assign (const rational&  x, const rational& w)
+  {
+    using wide_type = detail::wider_t<type>;
+
+    const auto fits   = [ ] (const wide_type& value) { return static_cast<wide_type>(static_cast<type>(value)) == value; };
+    const auto divide = [&] (const wide_type& dividend, const type& divisor)
+    {
+      return fits(dividend) ? static_cast<wide_type>(static_cast<type>(dividend) / divisor) : dividend / static_cast<wide_type>(divisor);
+    };
+    // gcd(a, b) = gcd(b, a mod b) brings the gcd of a wide integer and an integer of the rational to the latter.
+    const auto gcd    = [&] (const wide_type& lhs, const type& rhs)
+    {
+      return fits(lhs) ? detail::gcd(static_cast<type>(lhs), rhs) : detail::gcd(rhs, static_cast<type>(lhs % static_cast<wide_type>(rhs)));
+    };
+
+    // x * w = (a/g1)(c/g2) / (b/g2)(d/g1) where g1 = gcd(a, d) and g2 = gcd(c, b) (cross-cancellation).
+    const auto lhs_divisor = detail::gcd(x.numerator_, w.denominator_);
+    const auto rhs_divisor = detail::gcd(w.numerator_, x.denominator_);
+    wide_type p, q;
+    if (!detail::multiply_overflow(static_cast<wide_type>(x.numerator_   / lhs_divisor), static_cast<wide_type>(w.numerator_   / rhs_divisor), p) &&
+        !detail::multiply_overflow(static_cast<wide_type>(x.denominator_ / rhs_divisor), static_cast<wide_type>(w.denominator_ / lhs_divisor), q))
+    {
+      // p/q + n/d = (p(d/g) + n(q/g)) / (q/g)d where g = gcd(q, d) (Henrici). Any common factor of the numerator t and the denominator
+      // is a factor of g, hence the single reduction runs on t and g.
+      const auto divisor = gcd(q, denominator_);
+      const auto q_g     = divide(q, divisor);
+
+      wide_type lhs, rhs, t, result_denominator;
+      if (!detail::multiply_overflow(p  , static_cast<wide_type>(denominator_ / divisor), lhs) &&
+          !detail::multiply_overflow(q_g, static_cast<wide_type>(numerator_            ), rhs) &&
+          !detail::add_overflow     (lhs, rhs, t))
+      {
+        if (t == wide_type(0))
+        {
+          numerator_   = type(0);
+          denominator_ = type(1);
+          return *this;
+        }
+
+        const auto reducer          = gcd(t, divisor);
+        const auto result_numerator = divide(t, reducer);
+        if (!detail::multiply_overflow(q_g, static_cast<wide_type>(denominator_ / reducer), result_denominator) && fits(result_numerator) && fits(result_denominator))
+        {
+          numerator_   = static_cast<type>(result_numerator  );
+          denominator_ = static_cast<type>(result_denominator);
+          return *this;
+        }
+      }
+    }
+
+    rational product(x);
+    product *= w;
+    return *this += product;
+  }
+
+  // Increment and decrement operators.
+  constexpr rational&            operator++ ()
+  {
+    assign_result(add     (numerator_, denominator_), denominator_);
+    return *this;
+  }
+  constexpr rational&            operator-- ()
+  {
+    assign_result(subtract(numerator_, denominator_), denominator_);
+    return *this;
+  }
+  constexpr rational             operator++ (int)
+  {
+    rational result(*this);
+    ++(*this);
+    return result;
+  }
+  constexpr rational             operator-- (int)
+  {
+    rational result(*this);
+    --(*this);
+    return result;
+  }
+
+  // Accessor and mutators.
+  [[nodiscard]]
+  constexpr type numerator  () const
+  {
+    return numerator_;
+  }
+  constexpr void numerator  (const type& value)
+  {
+    numerator_   = value;
+    canonize();
+  }
+
+  [[nodiscard]]
+  constexpr type denominator() const
+  {
+    return denominator_;
+  }
+  constexpr void denominator(const type& value)
+  {
+    if (value == type(0))
+      detail::throw_error(rational_errc::zero_denominator);
+
+    denominator_ = value;
+    canonize();
+  }
+
+  constexpr void assign     (const type& numerator, const type& denominator)
+  {
+    if (denominator == type(0))
+      detail::throw_error(rational_errc::zero_denominator);
+
+    numerator_   = numerator  ;
+    denominator_ = denominator;
+    canonize();
+  }
+  template <floating_point that_type>
+  constexpr void assign     (const that_type& value)
+  {
+    if (const auto error = assign_floating_point(value); error != rational_errc())
+      detail::throw_error(error);
+  }
+
+#if defined(__cpp_lib_expected)
+  // Exception-free interface.
+  [[nodiscard]]
+  static constexpr std::expected<rational, rational_errc> make           (const type& numerator, const type& denominator = type(1)) noexcept
+  {
+    if (denominator == type(0))
+      return std::unexpected(rational_errc::zero_denominator);
+
+    return rational(numerator, denominator);
+  }
+  template <floating_point that_type> [[nodiscard]]
+  static constexpr std::expected<rational, rational_errc> make           (const that_type& value) noexcept
+  {
+    rational result;
+    if (const auto error = result.assign_floating_point(value); error != rational_errc())
+      return std::unexpected(error);
+    return result;
+  }
+
+  constexpr std::expected<void, rational_errc>            try_assign     (const type& numerator, const type& denominator) noexcept
+  {
+    if (denominator == type(0))
+      return std::unexpected(rational_errc::zero_denominator);
+
+    numerator_   = numerator  ;
+    denominator_ = denominator;
+    canonize();
+    return {};
+  }
+  template <floating_point that_type>
+  constexpr std::expected<void, rational_errc>            try_assign     (const that_type& value) noexcept
+  {
+    if (const auto error = assign_floating_point(value); error != rational_errc())
+      return std::unexpected(error);
+    return {};
+  }
+  constexpr std::expected<void, rational_errc>            try_denominator(const type& value) noexcept
+  {
+    if (value == type(0))
+      return std::unexpected(rational_errc::zero_denominator);
+
+    denominator_ = value;
+    canonize();
+    return {};
+  }
+
+  [[nodiscard]]
+  constexpr std::expected<rational, rational_errc>        try_divide     (const rational& that) const
+  {
+    if (that.numerator_ == type(0))
+      return std::unexpected(rational_errc::division_by_zero);
+
+    rational result(*this);
+    return result /= that;
+  }
+  [[nodiscard]]
+  constexpr std::expected<rational, rational_errc>        try_divide     (const type&     that) const
   {
-    // a / b / c / 1 = a / bc
     if (that == type(0))
-      throw std::domain_error("Division by zero.");
+      return std::unexpected(rational_errc::division_by_zero);
 
-    denominator_ *= that;
-    canonize();
-    return *this;
+    rational result(*this);
+    return result /= that;
   }
+#endif
 
-  // Increment and decrement operators.
-  constexpr rational&            operator++ ()
+  // Other functions.
+  // Floating point results are correctly rounded (to nearest, ties to even), integral results are truncated.
+  template <arithmetic result_type> [[nodiscard]]
+  constexpr result_type evaluate() const
   {
-    numerator_ += denominator_;
-    return *this;
+    if constexpr (std::is_floating_point_v<result_type>)
+      return detail::to_floating_point<result_type>(numerator_, denominator_, std::round_to_nearest);
+    else
+      return static_cast<result_type>(numerator_) / static_cast<result_type>(denominator_);
   }
-  constexpr rational&            operator-- ()
+  template <floating_point result_type> [[nodiscard]]
+  constexpr result_type evaluate(const std::float_round_style style) const
   {
-    numerator_ -= denominator_;
-    return *this;
+    return detail::to_floating_point<result_type>(numerator_, denominator_, style);
   }
-  constexpr rational             operator++ (int)
+  [[nodiscard]]
+  constexpr float       to_float (const std::float_round_style style = std::round_to_nearest) const
   {
-    rational result(*this);
-    ++(*this);
-    return result;
+    return evaluate<float >(style);
   }
-  constexpr rational             operator-- (int)
+  [[nodiscard]]
+  constexpr double      to_double(const std::float_round_style style = std::round_to_nearest) const
   {
-    rational result(*this);
-    --(*this);
-    return result;
+    return evaluate<double>(style);
   }
 
-  // Accessor and mutators.
+  // Approximation.
+  // The closest rational with a denominator of at most max_denominator (the rational itself if its denominator is small enough).
   [[nodiscard]]
-  constexpr type numerator  () const
+  constexpr rational limit_denominator(const type& max_denominator) const
   {
-    return numerator_;
+    using unsigned_type = detail::make_unsigned_t<type>;
+
+    if (type(1) > max_denominator)
+      detail::throw_error(rational_errc::zero_denominator);
+    if (denominator_ <= max_denominator)
+      return *this;
+
+    unsigned_type numerator, denominator;
+    detail::limit_denominator(detail::uabs(numerator_), static_cast<unsigned_type>(denominator_), static_cast<unsigned_type>(max_denominator), numerator, denominator);
+
+    // Convergents are canonical.
+    rational result;
+    result.numerator_   = static_cast<type>(type(0) > numerator_ ? unsigned_type(0) - numerator : numerator);
+    result.denominator_ = static_cast<type>(denominator);
+    return result;
   }
-  constexpr void numerator  (const type& value)
+  // The closest rational to a floating point value with a denominator of at most max_denominator. The value is converted as by the
+  // constructor first, values too small to be represented approximate to zero.
+  template <floating_point that_type, integral max_type> [[nodiscard]]
+  static constexpr rational approximate(const that_type& value, const max_type& max_denominator)
   {
-    numerator_   = value;
-    canonize();
+    rational result;
+    const auto error = result.assign_floating_point(value);
+    if (error == rational_errc::underflow)
+      return rational();
+    if (error != rational_errc())
+      detail::throw_error(error);
+    return result.limit_denominator(static_cast<type>(max_denominator));
   }
+  // The first convergent of the continued fraction expansion of a floating point value that lies within the tolerance, i.e. the 
+  // rational with the smallest denominator within the tolerance of the value (or the closest representable convergent). The 
+  // expansion and the error are computed in floating point, which avoids the conversion and all integer divisions.
+  template <floating_point that_type> [[nodiscard]]
+  static constexpr rational approximate(const that_type& value, const that_type& tolerance) requires (std::numeric_limits<type>::is_bounded)
+  {
+    using unsigned_type = std::make_unsigned_t<type>;
+    constexpr auto maximum = static_cast<unsigned_type>(std::numeric_limits<type>::max());
+    constexpr auto limit   = static_cast<that_type>(maximum); // Rounds up to a power of two for the wider types.
 
-  [[nodiscard]]
-  constexpr type denominator() const
+    if (!(value - value == that_type(0)))
+      detail::throw_error(rational_errc::not_finite);
+    if constexpr (!std::is_signed_v<type>)
+      if (value < that_type(0))
+        detail::throw_error(rational_errc::overflow);
+
+    const auto magnitude = value < that_type(0) ? -value : value;
+    if (magnitude >= limit)
+      detail::throw_error(rational_errc::overflow);
+
+    unsigned_type p0(0), q0(1), p1(1), q1(0);
+    auto remainder = magnitude;
+    while (true)
+    {
+      const auto term = static_cast<unsigned_type>(remainder);
+      unsigned_type product, next_p, next_q;
+      if (detail::multiply_overflow(term, p1, product) || detail::add_overflow(product, p0, next_p) || next_p > maximum ||
+          detail::multiply_overflow(term, q1, product) || detail::add_overflow(product, q0, next_q) || next_q > maximum)
+        break;
+      p0 = std::exchange(p1, next_p);
+      q0 = std::exchange(q1, next_q);
+
+      // |p/q - x| <= tolerance iff |p - qx| <= q tolerance, which saves a division.
+      const auto denominator = static_cast<that_type>(q1);
+      const auto error       = static_cast<that_type>(p1) - denominator * magnitude;
+      if ((error < that_type(0) ? -error : error) <= denominator * tolerance)
+        break;
+
+      const auto fraction = remainder - static_cast<that_type>(term);
+      if (fraction == that_type(0))
+        break;
+      remainder = that_type(1) / fraction;
+      if (remainder >= limit)
+        break;
+    }
+
+    // Convergents are canonical.
+    rational result;
+    result.numerator_   = static_cast<type>(value < that_type(0) ? unsigned_type(0) - p1 : p1);
+    result.denominator_ = static_cast<type>(q1);
+    return result;
+  }
+  
+protected:
+  // The integer type the arithmetic is evaluated in, and the overflow policy's primitives on it.
+  using intermediate_type = typename policy::template intermediate<type>;
+
+  static constexpr intermediate_type add     (const intermediate_type& lhs, const intermediate_type& rhs)
   {
-    return denominator_;
+    return policy::add     (lhs, rhs);
   }
-  constexpr void denominator(const type& value)
+  static constexpr intermediate_type subtract(const intermediate_type& lhs, const intermediate_type& rhs)
   {
-    if (value == type(0))
-      throw std::domain_error("Denominator can not be zero.");
+    return policy::subtract(lhs, rhs);
+  }
+  static constexpr intermediate_type multiply(const intermediate_type& lhs, const intermediate_type& rhs)
+  {
+    return policy::multiply(lhs, rhs);
+  }
 
-    denominator_ = value;
-    canonize();
+  // Assigns the (canonical) result of an operation evaluated in the intermediate type.
+  constexpr void assign_result(const intermediate_type& numerator, const intermediate_type& denominator)
+  {
+    numerator_   = policy::template narrow<type>(numerator  );
+    denominator_ = policy::template narrow<type>(denominator);
+
+    if constexpr (policy::saturating && std::numeric_limits<type>::is_bounded)
+    {
+      constexpr auto minimum = std::numeric_limits<type>::min();
+      constexpr auto maximum = std::numeric_limits<type>::max();
+      if (numerator_ == minimum || numerator_ == maximum || denominator_ == maximum)
+        canonize();
+    }
   }
 
-  constexpr void assign     (const type& numerator, const type& denominator)
+  // Completes the Henrici addition/subtraction given t = a(d/g) +- c(b/g), d and g = gcd(b, d). Any common factor of t and the 
+  // result's denominator (b/g)d is a factor of g, hence the final gcd runs on t and g instead of t and (b/g)d.
+  constexpr void add_reduced  (const intermediate_type& t, const type& that_denominator, const type& divisor)
   {
-    if (denominator == type(0))
-      throw std::domain_error("Denominator can not be zero.");
+    if (t == intermediate_type(0))
+    {
+      numerator_   = type(0);
+      denominator_ = type(1);
+      return;
+    }
 
-    numerator_   = numerator  ;
-    denominator_ = denominator;
-    canonize();
+    // If the intermediate type is wider, t mod g brings the gcd back to the integer type of the rational.
+    type reducer;
+    if constexpr (sizeof(intermediate_type) > sizeof(type))
+      reducer = detail::gcd(divisor, static_cast<type>(t % divisor));
+    else
+      reducer = detail::gcd(t, divisor);
+
+    assign_result(t / reducer, multiply(denominator_ / divisor, that_denominator / reducer));
   }
+
+  // Assigns the exact value of a floating point number, or the closest value with a power of two denominator if the denominator 
+  // would not fit the integer type. Returns a default-constructed error code on success. The result has a power of two denominator 
+  // and an odd numerator, hence is canonical without a gcd.
   template <floating_point that_type>
-  constexpr void assign     (const that_type& value)
+  constexpr rational_errc assign_floating_point(const that_type& value)
   {
-    // Reference: https://stackoverflow.com/questions/51142275/exact-value-of-a-floating-point-number-as-a-rational.
-    static const auto mantissa         = std::numeric_limits<that_type>::digits;
-    static const auto maximum_exponent = std::numeric_limits<that_type>::max_exponent;
+    constexpr auto mantissa_digits = std::numeric_limits<that_type>::digits;
+    static_assert(mantissa_digits <= std::numeric_limits<unsigned long long>::digits, "The mantissa must fit into an unsigned long long.");
+
+    if constexpr (std::numeric_limits<that_type>::is_iec559 && (sizeof(that_type) == sizeof(std::uint32_t) || sizeof(that_type) == sizeof(std::uint64_t)))
+    {
+      // Read the sign, the biased exponent and the fraction from the IEEE-754 binary32/binary64 representation directly.
+      using bits_type = std::conditional_t<sizeof(that_type) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+      constexpr auto fraction_bits = mantissa_digits - 1;
+      constexpr auto exponent_mask = 2 * std::numeric_limits<that_type>::max_exponent - 1;
+      constexpr auto exponent_bias =     std::numeric_limits<that_type>::max_exponent - 1;
+
+      const auto bits     = std::bit_cast<bits_type>(value);
+      const auto negative = (bits >> (std::numeric_limits<bits_type>::digits - 1)) != bits_type(0);
+      const auto biased   = static_cast<int>((bits >> fraction_bits) & static_cast<bits_type>(exponent_mask));
+      auto       mantissa = static_cast<unsigned long long>(bits & ((bits_type(1) << fraction_bits) - bits_type(1)));
+      auto       exponent = 1 - exponent_bias - fraction_bits; // Subnormals have no implicit leading bit and the minimum exponent.
 
-    if (!std::isfinite(value))
-      throw std::domain_error("Value can not be infinite.");
+      if (biased == exponent_mask)
+        return rational_errc::not_finite;
+      if (biased != 0)
+      {
+        mantissa |= 1ull << fraction_bits;
+        exponent += biased - 1;
+      }
+      if (mantissa == 0ull)
+      {
+        numerator_   = type(0);
+        denominator_ = type(1);
+        return rational_errc();
+      }
+      if constexpr (!std::numeric_limits<type>::is_signed)
+        if (negative)
+          return rational_errc::overflow;
 
-    auto exponent = 0;
-    numerator_    = static_cast<type>(std::frexp(value, &exponent) * static_cast<that_type>(std::exp2(mantissa)));
-    denominator_  = type(1);
-    exponent     -= mantissa;
+      const auto trailing_zeros = std::countr_zero(mantissa);
+      return assign_binary(negative, mantissa >> trailing_zeros, exponent + trailing_zeros);
+    }
 
-    if      (exponent > 0)
-      numerator_ *= static_cast<type>(std::exp2(exponent));
-    else if (exponent < 0)
+    else
     {
-      exponent = -exponent;
-      if (exponent >= maximum_exponent - 1)
+      // Infinity and NaN are the only values for which value - value is not zero.
+      if (!(value - value == that_type(0)))
+        return rational_errc::not_finite;
+
+      if (value == that_type(0))
       {
-        numerator_   /= static_cast<type>(std::exp2(exponent - (maximum_exponent - 1)));
-        denominator_ *= static_cast<type>(std::exp2(            maximum_exponent - 1 ));
+        numerator_   = type(0);
+        denominator_ = type(1);
+        return rational_errc();
+      }
 
-        if (numerator_ == 0)
-          throw std::domain_error("Value evaluates to zero due to being too small.");
+      if constexpr (!std::numeric_limits<type>::is_signed)
+        if (value < that_type(0))
+          return rational_errc::overflow;
 
-        assign(numerator_, denominator_);
-        return;
+      // Decompose the magnitude into an integer mantissa of mantissa_digits bits and a binary exponent. Scaling by powers of two is exact.
+      auto magnitude = value < that_type(0) ? -value : value;
+      auto exponent  = 0;
+      if (std::is_constant_evaluated())
+      {
+        constexpr auto lower = static_cast<that_type>(1ull << (mantissa_digits - 1));
+        constexpr auto upper = lower * that_type(2);
+        while (magnitude >= upper * that_type(1ull << 32)) { magnitude /= that_type(1ull << 32); exponent += 32; }
+        while (magnitude >= upper                        ) { magnitude /= that_type(2)         ; exponent +=  1; }
+        while (magnitude <  lower / that_type(1ull << 32)) { magnitude *= that_type(1ull << 32); exponent -= 32; }
+        while (magnitude <  lower                        ) { magnitude *= that_type(2)         ; exponent -=  1; }
+      }
+      else
+      {
+        magnitude = std::ldexp(std::frexp(magnitude, &exponent), mantissa_digits);
+        exponent -= mantissa_digits;
       }
-      denominator_ *= static_cast<type>(std::exp2(exponent));
-    }
 
-    assign(numerator_, denominator_);
+      auto mantissa = static_cast<unsigned long long>(magnitude);
+      const auto trailing_zeros = std::countr_zero(mantissa);
+      mantissa >>= trailing_zeros;
+      exponent  += trailing_zeros;
+
+      return assign_binary(value < that_type(0), mantissa, exponent);
+    }
   }
 
-  // Other functions.
-  template <arithmetic result_type> [[nodiscard]]
-  result_type    evaluate   () const
+  // Assigns (-1)^negative * mantissa * 2^exponent given an odd mantissa. The denominator is limited to 2^(digits - 1), excess bits of 
+  // the mantissa are rounded to nearest, ties to even (a value of half the least denominator's reciprocal underflows). Unbounded 
+  // integers represent any such value exactly. The result is canonical without a gcd, as the mantissa is odd or the exponent zero.
+  constexpr rational_errc assign_binary(const bool negative, unsigned long long mantissa, int exponent)
   {
-    return static_cast<result_type>(numerator_) / static_cast<result_type>(denominator_);
+    if constexpr (!std::numeric_limits<type>::is_bounded)
+    {
+      numerator_   = negative ? -type(mantissa) : type(mantissa);
+      denominator_ = type(1);
+      if (exponent > 0)
+        numerator_   <<=  exponent;
+      else
+        denominator_ <<= -exponent;
+      return rational_errc();
+    }
+
+    constexpr auto digits = std::numeric_limits<type>::digits;
+    constexpr auto word   = std::numeric_limits<unsigned long long>::digits;
+
+    if (exponent < -(digits - 1))
+    {
+      // Rounds up if the first dropped (guard) bit is set, and either any further dropped (sticky) bit or the kept last bit is.
+      const auto excess = -(digits - 1) - exponent;
+      const auto kept   = excess <  word ? mantissa >> excess : 0ull;
+      const auto guard  = excess <= word && ((mantissa >> (excess - 1)) & 1ull) != 0ull;
+      const auto sticky = excess <= word && (mantissa & ((1ull << (excess - 1)) - 1ull)) != 0ull;
+      mantissa = kept + (guard && (sticky || (kept & 1ull) != 0ull) ? 1ull : 0ull);
+      exponent = -(digits - 1);
+      if (mantissa == 0ull)
+        return rational_errc::underflow;
+
+      // Rounding may leave trailing zeros (e.g. 2 + 2^-31 ties to 2), which belong to the exponent before the width is checked.
+      const auto trailing_zeros = std::countr_zero(mantissa);
+      mantissa >>= trailing_zeros;
+      exponent  += trailing_zeros;
+    }
+
+    if (std::bit_width(mantissa) + (exponent > 0 ? exponent : 0) > digits)
+      return rational_errc::overflow;
+
+    numerator_   = static_cast<type>(exponent > 0 ? static_cast<type>(mantissa) << exponent : static_cast<type>(mantissa));
+    denominator_ = static_cast<type>(exponent < 0 ? type(1) << -exponent : type(1));
+    if (negative)
+      numerator_ = -numerator_;
+    return rational_errc();
   }
-  
-protected:
+
   // Canonical form implies that the numerator and denominator are co-prime integers (have no common factors) and the denominator is greater than zero.
-  void           canonize   ()
+  constexpr void canonize     ()
   {
-    const auto gcd = std::gcd(numerator_, denominator_);
+    const auto gcd = detail::gcd(numerator_, denominator_);
     numerator_   /= gcd;
     denominator_ /= gcd;
-    
+
+    normalize_sign();
+  }
+  // Moves the sign of a negative denominator to the numerator. The negation of the minimum overflows, which the policy handles (a 
+  // saturated maximum may share a factor with the other integer).
+  constexpr void normalize_sign()
+  {
     if (type(0) > denominator_)
     {
-      numerator_   = -numerator_  ;
-      denominator_ = -denominator_;
+      numerator_   = negate(numerator_  );
+      denominator_ = negate(denominator_);
+
+      if constexpr (policy::saturating && std::numeric_limits<type>::is_bounded)
+        if (numerator_ == std::numeric_limits<type>::max() || denominator_ == std::numeric_limits<type>::max())
+        {
+          const auto gcd = detail::gcd(numerator_, denominator_);
+          numerator_   /= gcd;
+          denominator_ /= gcd;
+        }
     }
   }
+  // Negates according to the policy.
+  static constexpr type negate(const type& value)
+  {
+    return policy::subtract(type(0), value);
+  }
 
   type numerator_  ;
   type denominator_;
 };
 
-// Arithmetic operators.
-template <integral type>
-constexpr rational<type>               operator+      (const rational<type>& lhs, const type&           rhs)
+// Layout guarantees: The rational is a vtable-free value type that is bitwise copyable and occupies exactly two integers,
+// so that contiguous containers of rationals may be memcpy'd, memmove'd and vectorized.
+template <integral type, overflow_policy policy = unchecked_policy>
+constexpr bool is_trivial_layout_v = 
+  sizeof(rational<type, policy>) == 2 * sizeof(type)            &&
+  std::is_standard_layout_v          <rational<type, policy>>   &&
+  std::is_trivially_copyable_v       <rational<type, policy>>   &&
+  std::is_trivially_destructible_v   <rational<type, policy>>   &&
+  !std::is_polymorphic_v             <rational<type, policy>>;
+
+static_assert(is_trivial_layout_v<int>               );
+static_assert(is_trivial_layout_v<long>              );
+static_assert(is_trivial_layout_v<long long>         );
+static_assert(is_trivial_layout_v<unsigned int>      );
+static_assert(is_trivial_layout_v<unsigned long>     );
+static_assert(is_trivial_layout_v<unsigned long long>);
+static_assert(is_trivial_layout_v<long long, checked_throw_policy   >);
+static_assert(is_trivial_layout_v<long long, checked_saturate_policy>);
+static_assert(is_trivial_layout_v<long long, promote_policy         >);
+
+// Arithmetic operators (see rational_expression.hpp for the ones on two rationals under RATIONAL_EXPRESSION_TEMPLATES).
+#if !defined(RATIONAL_EXPRESSION_TEMPLATES)
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>       operator+      (const rational<type, policy>& lhs, const rational<type, policy>& rhs)
 {
-  rational<type> result(lhs);
+  rational<type, policy> result(lhs);
   return result += rhs;
 }
-template <integral type>
-constexpr rational<type>               operator+      (const type&           lhs, const rational<type>& rhs)
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>       operator-      (const rational<type, policy>& lhs, const rational<type, policy>& rhs)
+{
+  rational<type, policy> result(lhs);
+  return result -= rhs;
+}
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>       operator*      (const rational<type, policy>& lhs, const rational<type, policy>& rhs)
+{
+  rational<type, policy> result(lhs);
+  return result *= rhs;
+}
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>       operator/      (const rational<type, policy>& lhs, const rational<type, policy>& rhs)
 {
-  rational<type> result(rhs);
+  rational<type, policy> result(lhs);
+  return result /= rhs;
+}
+#endif
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>       operator+      (const rational<type, policy>& lhs, const type&                   rhs)
+{
+  rational<type, policy> result(lhs);
+  return result += rhs;
+}
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>       operator+      (const type&                   lhs, const rational<type, policy>& rhs)
+{
+  rational<type, policy> result(rhs);
   return result += lhs;
 }
-template <integral type>
-constexpr rational<type>               operator-      (const rational<type>& lhs, const type&           rhs)
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>       operator-      (const rational<type, policy>& lhs, const type&                   rhs)
 {
-  rational<type> result(lhs);
+  rational<type, policy> result(lhs);
   return result -= rhs;
 }
-template <integral type>
-constexpr rational<type>               operator-      (const type&           lhs, const rational<type>& rhs)
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>       operator-      (const type&                   lhs, const rational<type, policy>& rhs)
 {
-  rational<type> result(rhs);
+  rational<type, policy> result(rhs);
   return -(result -= lhs);
 }
-template <integral type>
-constexpr rational<type>               operator*      (const rational<type>& lhs, const type&           rhs)
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>       operator*      (const rational<type, policy>& lhs, const type&                   rhs)
 {
-  rational<type> result(lhs);
+  rational<type, policy> result(lhs);
   return result *= rhs;
 }
-template <integral type>
-constexpr rational<type>               operator*      (const type&           lhs, const rational<type>& rhs)
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>       operator*      (const type&                   lhs, const rational<type, policy>& rhs)
 {
-  rational<type> result(rhs);
+  rational<type, policy> result(rhs);
   return result *= lhs;
 }
-template <integral type>
-constexpr rational<type>               operator/      (const rational<type>& lhs, const type&           rhs)
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>       operator/      (const rational<type, policy>& lhs, const type&                   rhs)
 {
-  rational<type> result(lhs);
+  rational<type, policy> result(lhs);
   return result /= rhs;
 }
-template <integral type>
-constexpr rational<type>               operator/      (const type&           lhs, const rational<type>& rhs)
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>       operator/      (const type&                   lhs, const rational<type, policy>& rhs)
 {
-  rational<type> result(lhs);
+  rational<type, policy> result(lhs);
   return result /= rhs;
 }
 
 // Stream operators.
-template<typename char_type, typename traits, integral type>
-std::basic_ostream<char_type, traits>& operator<<     (std::basic_ostream<char_type, traits>& stream, const rational<type>& value)
+template<typename char_type, typename traits, integral type, overflow_policy policy>
+std::basic_ostream<char_type, traits>& operator<<     (std::basic_ostream<char_type, traits>& stream, const rational<type, policy>& value)
 {
   stream << value.numerator() << '/' << value.denominator();
   return stream;
 }
-template<typename char_type, typename traits, integral type>
-std::basic_istream<char_type, traits>& operator>>     (std::basic_istream<char_type, traits>& stream,       rational<type>& value)
+template<typename char_type, typename traits, integral type, overflow_policy policy>
+std::basic_istream<char_type, traits>& operator>>     (std::basic_istream<char_type, traits>& stream,       rational<type, policy>& value)
 {
   type numerator  (0);
   type denominator(1);
@@ -354,6 +1870,135 @@ std::basic_istream<char_type, traits>& operator>>     (std::basic_istream<char_t
   return stream;
 }
 
+// Character conversion functions (locale-independent and non-allocating, as std::from_chars and std::to_chars).
+// Parses the pattern -?w(/d|.f| n/d)? into the canonical value, i.e. integers, fractions, exact decimals and mixed numbers. The minus 
+// sign is accepted for signed types only, the whole part of a mixed number takes the sign. On failure the value is left unmodified and
+// the error code is std::errc::invalid_argument if the input does not match the pattern or the denominator is zero, and 
+// std::errc::result_out_of_range if the canonical value does not fit the integer type or the numerator or denominator (w d + n and d of a
+// mixed number, the scaled digits and power of ten of a decimal) does not fit its unsigned counterpart. A zero value is parsed as 0/1
+// irrespective of the magnitude of its denominator.
+template <integral type, overflow_policy policy>
+constexpr std::from_chars_result       from_chars     (const char* first, const char* last, rational<type, policy>& value)
+{
+  using unsigned_type = detail::make_unsigned_t<type>;
+
+  auto current  = first;
+  auto negative = false;
+  if constexpr (std::numeric_limits<type>::is_signed)
+    if (current != last && *current == '-')
+    {
+      negative = true;
+      ++current;
+    }
+
+  unsigned_type numerator, denominator(1);
+  auto numerator_overflow   = false;
+  auto denominator_overflow = false;
+  const auto whole_end = detail::parse_digits(current, last, numerator, numerator_overflow);
+  if (whole_end == current)
+    return {first, std::errc::invalid_argument};
+  current = whole_end;
+
+  if      (current != last && *current == '/')
+  {
+    unsigned_type part_denominator;
+    auto part_overflow = false;
+    const auto end = detail::parse_digits(current + 1, last, part_denominator, part_overflow);
+    if (end != current + 1)
+    {
+      denominator_overflow = part_overflow;
+      denominator          = part_denominator;
+      current     = end;
+    }
+  }
+  else if (current != last && *current == '.')
+  {
+    // Trailing zeros of the fractional part are skipped rather than scaled.
+    auto end   = current + 1;
+    auto zeros = 0;
+    for (; end != last && *end >= '0' && *end <= '9'; ++end)
+    {
+      if (*end == '0')
+      {
+        ++zeros;
+        continue;
+      }
+      for (; zeros >= 0; --zeros)
+      {
+        numerator_overflow   |= detail::multiply_overflow(numerator  , unsigned_type(10), numerator  );
+        denominator_overflow |= detail::multiply_overflow(denominator, unsigned_type(10), denominator);
+      }
+      numerator_overflow |= detail::add_overflow(numerator, static_cast<unsigned_type>(*end - '0'), numerator);
+      zeros = 0;
+    }
+    if (end != current + 1)
+      current = end;
+  }
+  else if (current != last && *current == ' ')
+  {
+    unsigned_type part_numerator, part_denominator;
+    auto part_numerator_overflow   = false;
+    auto part_denominator_overflow = false;
+    const auto part_end = detail::parse_digits(current + 1, last, part_numerator, part_numerator_overflow);
+    if (part_end != current + 1 && part_end != last && *part_end == '/')
+    {
+      const auto end = detail::parse_digits(part_end + 1, last, part_denominator, part_denominator_overflow);
+      if (end != part_end + 1)
+      {
+        // w + n/d = (w d + n)/d.
+        numerator_overflow  |= part_numerator_overflow || detail::multiply_overflow(numerator, part_denominator, numerator) || detail::add_overflow(numerator, part_numerator, numerator);
+        denominator_overflow = part_denominator_overflow;
+        denominator          = part_denominator;
+        current     = end;
+      }
+    }
+  }
+
+  // Zero denominators and numerators are decided before overflow, an overflowed part is nonzero.
+  if (!denominator_overflow && denominator == unsigned_type(0))
+    return {first, std::errc::invalid_argument};
+  if (!numerator_overflow && numerator == unsigned_type(0))
+  {
+    value = type(0);
+    return {current, std::errc()};
+  }
+  if (numerator_overflow || denominator_overflow)
+    return {current, std::errc::result_out_of_range};
+
+  // The magnitude of a negative numerator may exceed the maximum by one. Reducing is only required if the value does not fit as is.
+  if constexpr (std::numeric_limits<type>::is_bounded)
+  {
+    constexpr auto maximum = static_cast<unsigned_type>(std::numeric_limits<type>::max());
+    if (numerator > maximum + unsigned_type(negative) || denominator > maximum)
+    {
+      const auto divisor = detail::gcd(numerator, denominator);
+      numerator   /= divisor;
+      denominator /= divisor;
+      if (numerator > maximum + unsigned_type(negative) || denominator > maximum)
+        return {current, std::errc::result_out_of_range};
+    }
+  }
+
+  const auto signed_numerator = static_cast<type>(negative ? unsigned_type(0) - numerator : numerator);
+  if (denominator == unsigned_type(1))
+    value = signed_numerator;
+  else
+    value.assign(signed_numerator, static_cast<type>(denominator));
+  return {current, std::errc()};
+}
+// Writes the value as n/d, as operator<<. On failure the error code is std::errc::value_too_large and ptr is last.
+template <integral type, overflow_policy policy>
+std::to_chars_result                   to_chars       (char* first, char* last, const rational<type, policy>& value)
+{
+  const auto result = std::to_chars(first, last, value.numerator());
+  if (result.ec != std::errc())
+    return result;
+  if (result.ptr == last)
+    return {last, std::errc::value_too_large};
+  *result.ptr = '/';
+  return std::to_chars(result.ptr + 1, last, value.denominator());
+}
+
 // Integer literals.
 constexpr rational<int>                operator"" r   (const unsigned long long value)
 {
@@ -381,51 +2026,218 @@ constexpr rational<unsigned long long> operator"" ullr(const unsigned long long
 }
 
 // Conversion functions to/from arithmetic type.
-template <arithmetic arithmetic_type, integral   integral_type>
-constexpr arithmetic_type         rational_cast(const rational<integral_type>& value)
+template <arithmetic arithmetic_type, integral   integral_type, overflow_policy policy>
+constexpr arithmetic_type                 rational_cast(const rational<integral_type, policy>& value)
 {
   return value.template evaluate<arithmetic_type>();
 }
-template <integral   integral_type  , arithmetic arithmetic_type>
-constexpr rational<integral_type> rational_cast(const arithmetic_type&         value)
+template <integral   integral_type  , overflow_policy policy = unchecked_policy, arithmetic arithmetic_type>
+constexpr rational<integral_type, policy> rational_cast(const arithmetic_type&                 value)
 {
-  return rational<integral_type>(value);
+  return rational<integral_type, policy>(value);
 }
 
 // Uniform member access functions.
-template <integral   type>
-constexpr type                    numerator    (const rational<type>&          value)
+template <integral   type, overflow_policy policy>
+constexpr type                            numerator    (const rational<type, policy>&          value)
 {
   return value.numerator();
 }
 template <arithmetic type>
-constexpr type                    numerator    (const type&                    value)
+constexpr type                            numerator    (const type&                            value)
 {
   return value;
 }
-template <integral   type>
-constexpr type                    denominator  (const rational<type>&          value)
+template <integral   type, overflow_policy policy>
+constexpr type                            denominator  (const rational<type, policy>&          value)
 {
   return value.denominator();
 }
 template <arithmetic type>
-constexpr type                    denominator  (const type&                    value)
+constexpr type                            denominator  (const type&                            value)
 {
   return type(1);
 }
 
 // Specializations for math functions.
-template <integral type>
-rational<type>                    abs          (const rational<type>&          value)
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>          abs          (const rational<type, policy>&          value)
 {
-  return {std::abs(value.numerator()), value.denominator()};
+  return type(0) > value.numerator() ? -value : value;
 }
-template <integral type>
-rational<type>                    pow          (const rational<type>&          value, const type& power)
+// Fused multiply-add: a * b + c with a single reduction (see rational::fma_assign).
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>          fma          (const rational<type, policy>&          a, const rational<type, policy>& b, rational<type, policy> c)
 {
-  return {std::pow(value.numerator(), power), std::pow(value.denominator(), power)};
+  return c.fma_assign(a, b);
+}
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy>          pow          (const rational<type, policy>&          value, const type& power)
+{
+  // Exponentiation by squaring. The powers of co-prime integers are co-prime.
+  auto numerator   = type(1);
+  auto denominator = type(1);
+  auto base_n      = value.numerator  ();
+  auto base_d      = value.denominator();
+  for (auto exponent = detail::uabs(power); exponent != 0; exponent /= 2)
+  {
+    if (exponent % 2 != 0)
+    {
+      numerator   = policy::multiply(numerator  , base_n);
+      denominator = policy::multiply(denominator, base_d);
+    }
+    if (exponent > 1)
+    {
+      base_n = policy::multiply(base_n, base_n);
+      base_d = policy::multiply(base_d, base_d);
+    }
+  }
+  return type(0) > power ? rational<type, policy>(denominator, numerator) : rational<type, policy>(numerator, denominator);
 }
 
+// Accumulates sums and products without canonicalization, as an opt-in alternative to chains of the arithmetic operators of rational 
+// (each of which runs a gcd). The numerator and the denominator are kept unreduced, and are reduced only when the next operation 
+// would overflow (checked with the overflow builtins) or when the value is observed. Operations that overflow even after the 
+// reduction are evaluated on the canonical rational, i.e. according to the overflow policy.
+template <integral type, overflow_policy policy = unchecked_policy>
+class rational_accumulator
+{
+public:
+  using value_type = rational<type, policy>;
+
+  // Constructors and destructor.
+  constexpr rational_accumulator         (const value_type& value = value_type())
+  : numerator_(value.numerator()), denominator_(value.denominator())
+  {
+
+  }
+  constexpr rational_accumulator         (const rational_accumulator&  that) = default;
+  constexpr rational_accumulator         (      rational_accumulator&& temp) = default;
+  constexpr ~rational_accumulator        ()                                  = default;
+
+  // Assignment operators.
+  constexpr rational_accumulator& operator= (const rational_accumulator&  that) = default;
+  constexpr rational_accumulator& operator= (      rational_accumulator&& temp) = default;
+
+  // Arithmetic assignment operators.
+  constexpr rational_accumulator& operator+=(const value_type&            that)
+  {
+    accumulate(that.numerator(), that.denominator(), false);
+    return *this;
+  }
+  constexpr rational_accumulator& operator-=(const value_type&            that)
+  {
+    accumulate(that.numerator(), that.denominator(), true );
+    return *this;
+  }
+  constexpr rational_accumulator& operator*=(const value_type&            that)
+  {
+    multiply(that.numerator(), that.denominator());
+    return *this;
+  }
+  // Accumulates x * w, without canonicalizing the product either.
+  constexpr rational_accumulator& fma_assign(const value_type& x, const value_type& w)
+  {
+    type numerator, denominator;
+    if (!detail::multiply_overflow(x.numerator(), w.numerator(), numerator) && !detail::multiply_overflow(x.denominator(), w.denominator(), denominator))
+      accumulate(numerator, denominator, false);
+    else
+      assign(value().fma_assign(x, w));
+    return *this;
+  }
+  // Merges partial results, e.g. of a parallel reduction.
+  constexpr rational_accumulator& operator+=(const rational_accumulator&  that)
+  {
+    accumulate(that.numerator_, that.denominator_, false);
+    return *this;
+  }
+  constexpr rational_accumulator& operator*=(const rational_accumulator&  that)
+  {
+    multiply(that.numerator_, that.denominator_);
+    return *this;
+  }
+
+  // Observers.
+  [[nodiscard]]
+  constexpr value_type value    () const
+  {
+    return value_type(numerator_, denominator_);
+  }
+  constexpr operator value_type () const
+  {
+    return value();
+  }
+
+  // Reduces the numerator and the denominator by their gcd.
+  constexpr void       reduce   ()
+  {
+    const auto divisor = detail::gcd(numerator_, denominator_);
+    numerator_   /= divisor;
+    denominator_ /= divisor;
+  }
+
+protected:
+  // a/b +- c/d = (ad +- cb)/(bd), or (a +- c)/b for equal denominators. Returns false (leaving the value unmodified) on overflow.
+  constexpr bool try_accumulate(const type& numerator, const type& denominator, const bool subtract)
+  {
+    type result_numerator, result_denominator = denominator_;
+    if (denominator_ == denominator)
+    {
+      if (subtract ? detail::subtract_overflow(numerator_, numerator, result_numerator) : detail::add_overflow(numerator_, numerator, result_numerator))
+        return false;
+    }
+    else
+    {
+      type lhs, rhs;
+      if (detail::multiply_overflow(numerator_  , denominator, lhs               ) ||
+          detail::multiply_overflow(numerator   , denominator_, rhs              ) ||
+          detail::multiply_overflow(denominator_, denominator, result_denominator) ||
+          (subtract ? detail::subtract_overflow(lhs, rhs, result_numerator) : detail::add_overflow(lhs, rhs, result_numerator)))
+        return false;
+    }
+    numerator_   = result_numerator  ;
+    denominator_ = result_denominator;
+    return true;
+  }
+  constexpr void accumulate    (const type& numerator, const type& denominator, const bool subtract)
+  {
+    if (try_accumulate(numerator, denominator, subtract))
+      return;
+    reduce();
+    if (try_accumulate(numerator, denominator, subtract))
+      return;
+    auto result = value();
+    if (subtract)
+      result -= value_type(numerator, denominator);
+    else
+      result += value_type(numerator, denominator);
+    assign(result);
+  }
+  constexpr void multiply      (const type& numerator, const type& denominator)
+  {
+    for (auto attempt = 0; attempt < 2; ++attempt)
+    {
+      type result_numerator, result_denominator;
+      if (!detail::multiply_overflow(numerator_, numerator, result_numerator) && !detail::multiply_overflow(denominator_, denominator, result_denominator))
+      {
+        numerator_   = result_numerator  ;
+        denominator_ = result_denominator;
+        return;
+      }
+      reduce();
+    }
+    assign(value() * value_type(numerator, denominator));
+  }
+  constexpr void assign        (const value_type& value)
+  {
+    numerator_   = value.numerator  ();
+    denominator_ = value.denominator();
+  }
+
+  type numerator_  ;
+  type denominator_;
+};
+
 // TODO Potential: Specializations for more math functions.
 // TODO Potential: Language modification operator\ (backslash may still be used as a line continuation in macros, and as a escape sequence in string literals)
 // template <integral type>
@@ -433,4 +2245,38 @@ rational<type>                    pow          (const rational<type>&          v
 // {
 //   return {lhs, rhs};
 // }
-}
\ No newline at end of file
+}
+
+#if defined(__cpp_lib_format)
+// Formats a rational into the output iterator, without temporary strings (see detail::format_specification for the specification).
+template <std::experimental::integral type, std::experimental::overflow_policy policy, typename char_type> requires (std::is_integral_v<type>)
+struct std::formatter<std::experimental::rational<type, policy>, char_type>
+{
+  constexpr auto parse (basic_format_parse_context<char_type>& context)
+  {
+    auto current = context.begin();
+    if (!std::experimental::detail::parse_format_specification(current, context.end(), specification_))
+    {
+#if defined(RATIONAL_NO_EXCEPTIONS)
+      std::abort();
+#else
+      throw format_error("Invalid rational format specification.");
+#endif
+    }
+    return current;
+  }
+
+  template <typename format_context>
+  auto           format(const std::experimental::rational<type, policy>& value, format_context& context) const
+  {
+    return std::experimental::detail::format_rational(context.out(), value.numerator(), value.denominator(), specification_);
+  }
+
+protected:
+  std::experimental::detail::format_specification<char_type> specification_ {};
+};
+#endif
+
+#if defined(RATIONAL_EXPRESSION_TEMPLATES)
+#include <std/experimental/rational_expression.hpp>
+#endif
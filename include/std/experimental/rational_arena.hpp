@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include <std/experimental/big_integer.hpp>
+#include <std/experimental/rational.hpp>
+
+namespace std::experimental
+{
+namespace pmr
+{
+// Rationals of big integers with polymorphic allocators.
+template <overflow_policy policy = unchecked_policy>
+using rational = experimental::rational<big_integer, policy>;
+}
+
+// A monotonic arena for the evaluation of a batch of expressions on pmr::rational (or pmr::big_integer): While in scope, the limbs
+// of all pmr::big_integer constructed on this thread (including the temporaries of the arithmetic) are allocated from the arena by a
+// pointer bump, and the deallocations are no-ops. reset() frees all of them at once, after which the values allocated since the
+// construction (or the previous reset) must no longer be used. Results to keep are converted to big_integer (or copied out of the
+// scope) before. The arenas of a thread nest, each restoring the previous resource on destruction.
+class rational_arena
+{
+public:
+  // Constructors and destructor.
+  explicit rational_arena         (const std::size_t initial_size = 64 * 1024, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+  : buffer_(initial_size, upstream), resource_(buffer_.data(), buffer_.size(), upstream), previous_(std::exchange(detail::current_resource(), &resource_))
+  {
+
+  }
+  rational_arena                  (const rational_arena&  that) = delete;
+  rational_arena                  (      rational_arena&& temp) = delete;
+  ~rational_arena                 ()
+  {
+    detail::current_resource() = previous_;
+  }
+
+  // Assignment operators.
+  rational_arena& operator=       (const rational_arena&  that) = delete;
+  rational_arena& operator=       (      rational_arena&& temp) = delete;
+
+  // Frees all memory allocated from the arena. The initial buffer is kept for reuse, further buffers are returned to the upstream resource.
+  void                       reset   ()
+  {
+    resource_.release();
+  }
+  [[nodiscard]]
+  std::pmr::memory_resource* resource()
+  {
+    return &resource_;
+  }
+
+protected:
+  std::pmr::vector<std::byte>         buffer_  ;
+  std::pmr::monotonic_buffer_resource resource_;
+  std::pmr::memory_resource*          previous_;
+};
+}
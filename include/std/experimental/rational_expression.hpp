@@ -0,0 +1,307 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+#include <std/experimental/rational.hpp>
+
+#if !defined(RATIONAL_EXPRESSION_TEMPLATES)
+#error "Define RATIONAL_EXPRESSION_TEMPLATES (for the whole project) to enable the expression templates of rational.hpp."
+#endif
+
+// Expression templates for the arithmetic operators of rational (opt-in through RATIONAL_EXPRESSION_TEMPLATES): The binary operators
+// on rationals return an expression tree instead of a canonical rational. The tree is evaluated when it is converted (or assigned) to
+// a rational: On the unreduced numerators and denominators (without a gcd per operation), checked with the overflow builtins, and
+// canonized once. If an intermediate overflows, the tree is evaluated operation by operation on canonical rationals instead, i.e.
+// according to the overflow policy. Rationals of unbounded integers (e.g. big_integer) are referenced by an expression, hence it must
+// not outlive them (e.g. through auto), and functions deducing a rational require an explicit conversion (e.g. abs(rational(a * b))).
+namespace std::experimental
+{
+template <integral type, overflow_policy policy, typename operation, typename lhs_type, typename rhs_type>
+class rational_expression;
+
+namespace detail
+{
+// An unreduced fraction, whose denominator may be negative.
+template <integral type>
+struct fraction
+{
+  type numerator  ;
+  type denominator;
+};
+
+template <typename operand_type>
+struct expression_traits
+{
+  static constexpr bool is_rational   = false;
+  static constexpr bool is_expression = false;
+};
+template <integral type, overflow_policy policy>
+struct expression_traits<rational<type, policy>>
+{
+  using integer_type = type;
+  using policy_type  = policy;
+  using value_type   = rational<type, policy>;
+
+  static constexpr bool is_rational   = true ;
+  static constexpr bool is_expression = false;
+};
+template <integral type, overflow_policy policy, typename operation, typename lhs_type, typename rhs_type>
+struct expression_traits<rational_expression<type, policy, operation, lhs_type, rhs_type>>
+{
+  using integer_type = type;
+  using policy_type  = policy;
+  using value_type   = rational<type, policy>;
+
+  static constexpr bool is_rational   = false;
+  static constexpr bool is_expression = true ;
+};
+
+template <typename lhs_type, typename rhs_type>
+concept same_rational_type = std::same_as<typename expression_traits<lhs_type>::value_type, typename expression_traits<rhs_type>::value_type>;
+
+// Rationals or expressions of the same rational type, or integers of its integer type, of which at least one is an expression, or
+// both are rationals.
+template <typename lhs_type, typename rhs_type>
+concept expression_operands =
+  (expression_traits<lhs_type>::is_expression && (same_rational_type<lhs_type, rhs_type> || std::same_as<rhs_type, typename expression_traits<lhs_type>::integer_type>)) ||
+  (expression_traits<rhs_type>::is_expression && (same_rational_type<lhs_type, rhs_type> || std::same_as<lhs_type, typename expression_traits<rhs_type>::integer_type>)) ||
+  (expression_traits<lhs_type>::is_rational   && expression_traits<rhs_type>::is_rational && same_rational_type<lhs_type, rhs_type>);
+
+// Rationals of unbounded integers are referenced, other operands are copied (which is as cheap as a reference for fixed width integers).
+template <typename operand_type>
+using expression_storage_t = std::conditional_t<expression_traits<operand_type>::is_rational && !std::is_trivially_copyable_v<operand_type>, const operand_type&, operand_type>;
+
+template <integral type, overflow_policy policy>
+constexpr bool                   fuse_operand    (const rational<type, policy>& operand, fraction<type>& result)
+{
+  result = {operand.numerator(), operand.denominator()};
+  return true;
+}
+template <integral type>
+constexpr bool                   fuse_operand    (const type&                   operand, fraction<type>& result)
+{
+  result = {operand, type(1)};
+  return true;
+}
+template <integral type, overflow_policy policy, typename operation, typename lhs_type, typename rhs_type>
+constexpr bool                   fuse_operand    (const rational_expression<type, policy, operation, lhs_type, rhs_type>& operand, fraction<type>& result)
+{
+  return operand.fuse(result);
+}
+
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy> evaluate_operand(const rational<type, policy>& operand)
+{
+  return operand;
+}
+template <integral type, overflow_policy policy>
+constexpr rational<type, policy> evaluate_operand(const type&                   operand)
+{
+  return rational<type, policy>(operand);
+}
+template <integral type, overflow_policy policy, typename operation, typename lhs_type, typename rhs_type>
+constexpr rational<type, policy> evaluate_operand(const rational_expression<type, policy, operation, lhs_type, rhs_type>& operand)
+{
+  return operand.evaluate();
+}
+
+// The operations provide the unreduced evaluation (fuse, returning false on overflow) and the evaluation on canonical rationals.
+struct add_operation
+{
+  template <integral type>
+  static constexpr bool                   fuse    (const fraction<type>& lhs, const fraction<type>& rhs, fraction<type>& result)
+  {
+    // a/b + c/b = (a + c)/b, a/b + c/d = (ad + cb)/bd.
+    if (lhs.denominator == rhs.denominator)
+    {
+      result.denominator = lhs.denominator;
+      return !add_overflow(lhs.numerator, rhs.numerator, result.numerator);
+    }
+    type lhs_numerator, rhs_numerator;
+    return
+      !multiply_overflow(lhs.numerator  , rhs.denominator, lhs_numerator     ) &&
+      !multiply_overflow(rhs.numerator  , lhs.denominator, rhs_numerator     ) &&
+      !multiply_overflow(lhs.denominator, rhs.denominator, result.denominator) &&
+      !add_overflow     (lhs_numerator  , rhs_numerator  , result.numerator  );
+  }
+  template <integral type, overflow_policy policy>
+  static constexpr rational<type, policy> evaluate(rational<type, policy> lhs, const rational<type, policy>& rhs)
+  {
+    return lhs += rhs;
+  }
+};
+struct subtract_operation
+{
+  template <integral type>
+  static constexpr bool                   fuse    (const fraction<type>& lhs, const fraction<type>& rhs, fraction<type>& result)
+  {
+    // a/b - c/b = (a - c)/b, a/b - c/d = (ad - cb)/bd.
+    if (lhs.denominator == rhs.denominator)
+    {
+      result.denominator = lhs.denominator;
+      return !subtract_overflow(lhs.numerator, rhs.numerator, result.numerator);
+    }
+    type lhs_numerator, rhs_numerator;
+    return
+      !multiply_overflow(lhs.numerator  , rhs.denominator, lhs_numerator     ) &&
+      !multiply_overflow(rhs.numerator  , lhs.denominator, rhs_numerator     ) &&
+      !multiply_overflow(lhs.denominator, rhs.denominator, result.denominator) &&
+      !subtract_overflow(lhs_numerator  , rhs_numerator  , result.numerator  );
+  }
+  template <integral type, overflow_policy policy>
+  static constexpr rational<type, policy> evaluate(rational<type, policy> lhs, const rational<type, policy>& rhs)
+  {
+    return lhs -= rhs;
+  }
+};
+struct multiply_operation
+{
+  template <integral type>
+  static constexpr bool                   fuse    (const fraction<type>& lhs, const fraction<type>& rhs, fraction<type>& result)
+  {
+    // a/b * c/d = ac/bd.
+    return
+      !multiply_overflow(lhs.numerator  , rhs.numerator  , result.numerator  ) &&
+      !multiply_overflow(lhs.denominator, rhs.denominator, result.denominator);
+  }
+  template <integral type, overflow_policy policy>
+  static constexpr rational<type, policy> evaluate(rational<type, policy> lhs, const rational<type, policy>& rhs)
+  {
+    return lhs *= rhs;
+  }
+};
+struct divide_operation
+{
+  template <integral type>
+  static constexpr bool                   fuse    (const fraction<type>& lhs, const fraction<type>& rhs, fraction<type>& result)
+  {
+    // a/b / c/d = ad/bc (the sign of the denominator is normalized by the canonization).
+    if (rhs.numerator == type(0))
+      throw_error(rational_errc::division_by_zero);
+    return
+      !multiply_overflow(lhs.numerator  , rhs.denominator, result.numerator  ) &&
+      !multiply_overflow(lhs.denominator, rhs.numerator  , result.denominator);
+  }
+  template <integral type, overflow_policy policy>
+  static constexpr rational<type, policy> evaluate(rational<type, policy> lhs, const rational<type, policy>& rhs)
+  {
+    return lhs /= rhs;
+  }
+};
+
+template <typename operation, typename lhs_type, typename rhs_type>
+constexpr auto make_expression(const lhs_type& lhs, const rhs_type& rhs)
+{
+  using traits = std::conditional_t<expression_traits<lhs_type>::is_rational || expression_traits<lhs_type>::is_expression, expression_traits<lhs_type>, expression_traits<rhs_type>>;
+  return rational_expression<typename traits::integer_type, typename traits::policy_type, operation, lhs_type, rhs_type>(lhs, rhs);
+}
+}
+
+// A binary operation on rationals, expressions or integers, evaluated on conversion to rational.
+template <integral type, overflow_policy policy, typename operation, typename lhs_type, typename rhs_type>
+class rational_expression
+{
+public:
+  using value_type = rational<type, policy>;
+
+  // Constructors and destructor.
+  constexpr rational_expression         (const lhs_type& lhs, const rhs_type& rhs)
+  : lhs_(lhs), rhs_(rhs)
+  {
+
+  }
+  constexpr rational_expression         (const rational_expression&  that) = default;
+  constexpr rational_expression         (      rational_expression&& temp) = default;
+  constexpr ~rational_expression        ()                                 = default;
+
+  // Comparison operators (on the value).
+  template <typename that_type>
+  friend constexpr bool operator== (const rational_expression& lhs, const that_type& rhs)
+  {
+    return lhs.value() == rhs;
+  }
+  template <typename that_type>
+  friend constexpr auto operator<=>(const rational_expression& lhs, const that_type& rhs)
+  {
+    return lhs.value() <=> rhs;
+  }
+
+  // Observers.
+  // The canonical value, with a single canonization unless an intermediate overflows.
+  [[nodiscard]]
+  constexpr value_type value      () const
+  {
+    detail::fraction<type> result;
+    if (fuse(result))
+      return value_type(result.numerator, result.denominator);
+    return evaluate();
+  }
+  constexpr operator value_type   () const
+  {
+    return value();
+  }
+  [[nodiscard]]
+  constexpr type       numerator  () const
+  {
+    return value().numerator  ();
+  }
+  [[nodiscard]]
+  constexpr type       denominator() const
+  {
+    return value().denominator();
+  }
+
+  // Evaluates the unreduced fraction. Returns false on overflow.
+  constexpr bool       fuse       (detail::fraction<type>& result) const
+  {
+    detail::fraction<type> lhs, rhs;
+    return detail::fuse_operand(lhs_, lhs) && detail::fuse_operand(rhs_, rhs) && operation::fuse(lhs, rhs, result);
+  }
+  // Evaluates operation by operation on canonical rationals.
+  [[nodiscard]]
+  constexpr value_type evaluate   () const
+  {
+    return operation::evaluate(detail::evaluate_operand<type, policy>(lhs_), detail::evaluate_operand<type, policy>(rhs_));
+  }
+
+protected:
+  detail::expression_storage_t<lhs_type> lhs_;
+  detail::expression_storage_t<rhs_type> rhs_;
+};
+
+// Unary arithmetic operators.
+template <typename operand_type> requires detail::expression_traits<operand_type>::is_expression
+constexpr auto operator+(const operand_type& operand)
+{
+  return operand;
+}
+template <typename operand_type> requires detail::expression_traits<operand_type>::is_expression
+constexpr auto operator-(const operand_type& operand)
+{
+  using integer_type = typename detail::expression_traits<operand_type>::integer_type;
+  return detail::make_expression<detail::subtract_operation>(integer_type(0), operand);
+}
+
+// Binary arithmetic operators (replacing the ones of rational.hpp on two rationals).
+template <typename lhs_type, typename rhs_type> requires detail::expression_operands<lhs_type, rhs_type>
+constexpr auto operator+(const lhs_type& lhs, const rhs_type& rhs)
+{
+  return detail::make_expression<detail::add_operation     >(lhs, rhs);
+}
+template <typename lhs_type, typename rhs_type> requires detail::expression_operands<lhs_type, rhs_type>
+constexpr auto operator-(const lhs_type& lhs, const rhs_type& rhs)
+{
+  return detail::make_expression<detail::subtract_operation>(lhs, rhs);
+}
+template <typename lhs_type, typename rhs_type> requires detail::expression_operands<lhs_type, rhs_type>
+constexpr auto operator*(const lhs_type& lhs, const rhs_type& rhs)
+{
+  return detail::make_expression<detail::multiply_operation>(lhs, rhs);
+}
+template <typename lhs_type, typename rhs_type> requires detail::expression_operands<lhs_type, rhs_type>
+constexpr auto operator/(const lhs_type& lhs, const rhs_type& rhs)
+{
+  return detail::make_expression<detail::divide_operation  >(lhs, rhs);
+}
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+
+// Exact reductions of sequences of rationals (sum, product, dot product), sequential or parallel according to an execution policy.
+// Note that the parallel policies of libstdc++ require linking against TBB (e.g. -ltbb), and that overflow errors thrown under a
+// parallel policy (e.g. by checked_throw_policy) call std::terminate, as with the standard algorithms.
+namespace std::experimental
+{
+namespace detail
+{
+template <typename type>
+struct rational_traits;
+template <integral type, overflow_policy policy>
+struct rational_traits<rational<type, policy>>
+{
+  using accumulator_type = rational_accumulator<type, policy>;
+};
+
+// The number of consecutive elements accumulated by a single task.
+constexpr std::size_t reduction_block_size = 1024;
+
+// Accumulates each block of [0, size) into a partial result with the given function (in parallel according to the execution policy),
+// then combines the partial results pairwise in a balanced tree, so that the denominators of the operands of each combination grow
+// alike rather than one of them growing along a chain. The partial results are accumulators, hence reduced only on overflow.
+template <typename accumulator_type, typename execution_policy, typename block_function, typename combine_function>
+accumulator_type reduce_blocks(execution_policy&& execution, const std::size_t size, const accumulator_type& identity, block_function&& block, combine_function&& combine)
+{
+  if (size == 0)
+    return identity;
+
+  std::vector<accumulator_type> partials((size + reduction_block_size - 1) / reduction_block_size, identity);
+  const auto                    data = partials.data();
+
+  std::for_each(execution, partials.begin(), partials.end(), [&] (accumulator_type& partial)
+  {
+    const auto index = static_cast<std::size_t>(&partial - data) * reduction_block_size;
+    block(partial, index, std::min(index + reduction_block_size, size));
+  });
+  for (std::size_t stride = 1; stride < partials.size(); stride *= 2)
+    std::for_each(execution, partials.begin(), partials.end(), [&] (accumulator_type& partial)
+    {
+      const auto index = static_cast<std::size_t>(&partial - data);
+      if (index % (2 * stride) == 0 && index + stride < partials.size())
+        combine(partial, data[index + stride]);
+    });
+
+  return partials.front();
+}
+}
+
+// The sum of the elements of [first, last).
+template <typename execution_policy, std::random_access_iterator iterator_type>
+requires std::is_execution_policy_v<std::remove_cvref_t<execution_policy>>
+[[nodiscard]]
+std::iter_value_t<iterator_type> rational_sum    (execution_policy&& execution, const iterator_type first, const iterator_type last)
+{
+  using value_type       = std::iter_value_t<iterator_type>;
+  using accumulator_type = typename detail::rational_traits<value_type>::accumulator_type;
+
+  return detail::reduce_blocks(execution, static_cast<std::size_t>(last - first), accumulator_type(value_type(0)),
+    [&] (accumulator_type& partial, const std::size_t begin, const std::size_t end)
+    {
+      for (auto i = begin; i < end; ++i)
+        partial += static_cast<value_type>(first[i]);
+    },
+    [ ] (accumulator_type& lhs, const accumulator_type& rhs)
+    {
+      lhs += rhs;
+    }).value();
+}
+// The product of the elements of [first, last).
+template <typename execution_policy, std::random_access_iterator iterator_type>
+requires std::is_execution_policy_v<std::remove_cvref_t<execution_policy>>
+[[nodiscard]]
+std::iter_value_t<iterator_type> rational_product(execution_policy&& execution, const iterator_type first, const iterator_type last)
+{
+  using value_type       = std::iter_value_t<iterator_type>;
+  using accumulator_type = typename detail::rational_traits<value_type>::accumulator_type;
+
+  return detail::reduce_blocks(execution, static_cast<std::size_t>(last - first), accumulator_type(value_type(1)),
+    [&] (accumulator_type& partial, const std::size_t begin, const std::size_t end)
+    {
+      for (auto i = begin; i < end; ++i)
+        partial *= static_cast<value_type>(first[i]);
+    },
+    [ ] (accumulator_type& lhs, const accumulator_type& rhs)
+    {
+      lhs *= rhs;
+    }).value();
+}
+// The sum of the products of the elements of [first1, last1) and the corresponding elements of [first2, ...).
+template <typename execution_policy, std::random_access_iterator iterator_type_1, std::random_access_iterator iterator_type_2>
+requires std::is_execution_policy_v<std::remove_cvref_t<execution_policy>>
+[[nodiscard]]
+std::iter_value_t<iterator_type_1> rational_dot  (execution_policy&& execution, const iterator_type_1 first1, const iterator_type_1 last1, const iterator_type_2 first2)
+{
+  using value_type       = std::iter_value_t<iterator_type_1>;
+  using accumulator_type = typename detail::rational_traits<value_type>::accumulator_type;
+
+  return detail::reduce_blocks(execution, static_cast<std::size_t>(last1 - first1), accumulator_type(value_type(0)),
+    [&] (accumulator_type& partial, const std::size_t begin, const std::size_t end)
+    {
+      // The products are not canonicalized either.
+      for (auto i = begin; i < end; ++i)
+        partial.fma_assign(static_cast<value_type>(first1[i]), static_cast<value_type>(first2[i]));
+    },
+    [ ] (accumulator_type& lhs, const accumulator_type& rhs)
+    {
+      lhs += rhs;
+    }).value();
+}
+
+// Sequential overloads.
+template <std::random_access_iterator iterator_type>
+[[nodiscard]]
+std::iter_value_t<iterator_type>   rational_sum    (const iterator_type first, const iterator_type last)
+{
+  return rational_sum    (std::execution::seq, first, last);
+}
+template <std::random_access_iterator iterator_type>
+[[nodiscard]]
+std::iter_value_t<iterator_type>   rational_product(const iterator_type first, const iterator_type last)
+{
+  return rational_product(std::execution::seq, first, last);
+}
+template <std::random_access_iterator iterator_type_1, std::random_access_iterator iterator_type_2>
+[[nodiscard]]
+std::iter_value_t<iterator_type_1> rational_dot    (const iterator_type_1 first1, const iterator_type_1 last1, const iterator_type_2 first2)
+{
+  return rational_dot    (std::execution::seq, first1, last1, first2);
+}
+}
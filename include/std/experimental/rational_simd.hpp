@@ -0,0 +1,365 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+#include <std/experimental/rational.hpp>
+
+namespace std::experimental
+{
+// A structure-of-arrays view of rationals: The numerators and the denominators are stored in separate (contiguous) arrays, which
+// allows the batch operations below to process several rationals per instruction.
+template <integral type>
+struct rational_span
+{
+  [[nodiscard]]
+  constexpr std::size_t size() const
+  {
+    return numerators.size();
+  }
+
+  constexpr operator rational_span<const type>() const requires (!std::is_const_v<type>)
+  {
+    return {numerators, denominators};
+  }
+
+  std::span<type> numerators  ;
+  std::span<type> denominators;
+};
+
+namespace detail::simd
+{
+// Instruction sets for the batch operations. Each holds a number of 64-bit lanes (in which the products of 32-bit integers are exact)
+// and provides the primitives of the kernels below. The masks are vectors (or mask registers) with all bits of a lane set where true.
+// Lanes hold non-negative values below 2^63 wherever an unsigned interpretation is required, hence signed comparisons suffice.
+
+// One lane in general purpose registers. Handles the remaining elements, and serves as the fallback on all other architectures.
+struct scalar
+{
+  using vector = std::int64_t;
+  using mask   = bool;
+  static constexpr std::size_t lanes = 1;
+
+  static vector load      (const std::int32_t* source)                  { return *source; }
+  static void   store     (std::int32_t* target, const vector value)    { *target = static_cast<std::int32_t>(value); }
+  static vector broadcast (const std::int64_t value)                    { return value; }
+  static vector add       (const vector lhs, const vector rhs)          { return static_cast<vector>(static_cast<std::uint64_t>(lhs) + static_cast<std::uint64_t>(rhs)); }
+  static vector subtract  (const vector lhs, const vector rhs)          { return static_cast<vector>(static_cast<std::uint64_t>(lhs) - static_cast<std::uint64_t>(rhs)); }
+  static vector multiply  (const vector lhs, const vector rhs)          { return static_cast<std::int32_t>(lhs) * static_cast<std::int64_t>(static_cast<std::int32_t>(rhs)); }
+  static vector multiply_low(const vector lhs, const vector rhs)        { return static_cast<vector>(static_cast<std::uint64_t>(static_cast<std::uint32_t>(lhs)) * static_cast<std::uint32_t>(rhs)); }
+  static vector bitwise_or(const vector lhs, const vector rhs)          { return lhs | rhs; }
+  static vector shift_right(const vector value, const vector count)     { return count < 64 ? static_cast<vector>(static_cast<std::uint64_t>(value) >> count) : 0; }
+  static vector countr_zero(const vector value)                         { return std::countr_zero(static_cast<std::uint64_t>(value)); }
+  static vector minimum   (const vector lhs, const vector rhs)          { return lhs < rhs ? lhs : rhs; }
+  static vector maximum   (const vector lhs, const vector rhs)          { return lhs < rhs ? rhs : lhs; }
+  static mask   negative  (const vector value)                          { return value < 0; }
+  static mask   zero      (const vector value)                          { return value == 0; }
+  static bool   all       (const mask   value)                          { return value; }
+  static vector select    (const mask condition, const vector lhs, const vector rhs) { return condition ? lhs : rhs; }
+};
+
+#if defined(__SSE2__) || defined(_M_X64)
+// Two lanes with SSE2 (the x86-64 baseline). 64-bit comparisons, variable shifts and signed multiplications are emulated.
+struct sse2
+{
+  using vector = __m128i;
+  using mask   = __m128i;
+  static constexpr std::size_t lanes = 2;
+
+  static vector load      (const std::int32_t* source)
+  {
+    const auto value = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source));
+    return _mm_unpacklo_epi32(value, _mm_srai_epi32(value, 31));
+  }
+  static void   store     (std::int32_t* target, const vector value)
+  {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(target), _mm_shuffle_epi32(value, _MM_SHUFFLE(3, 1, 2, 0)));
+  }
+  static vector broadcast (const std::int64_t value)                    { return _mm_set1_epi64x(value); }
+  static vector add       (const vector lhs, const vector rhs)          { return _mm_add_epi64(lhs, rhs); }
+  static vector subtract  (const vector lhs, const vector rhs)          { return _mm_sub_epi64(lhs, rhs); }
+  static vector multiply  (const vector lhs, const vector rhs)
+  {
+    // The unsigned product exceeds the signed one by 2^32 times the other operand for each negative operand (modulo 2^64).
+    const auto correction = _mm_add_epi64(_mm_and_si128(lhs, negative(rhs)), _mm_and_si128(rhs, negative(lhs)));
+    return _mm_sub_epi64(_mm_mul_epu32(lhs, rhs), _mm_slli_epi64(correction, 32));
+  }
+  static vector multiply_low(const vector lhs, const vector rhs)        { return _mm_mul_epu32(lhs, rhs); }
+  static vector bitwise_or(const vector lhs, const vector rhs)          { return _mm_or_si128(lhs, rhs); }
+  static vector shift_right(const vector value, const vector count)
+  {
+    const auto low  = _mm_srl_epi64(value, count);
+    const auto high = _mm_srl_epi64(value, _mm_unpackhi_epi64(count, count));
+    return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(high), _mm_castsi128_pd(low)));
+  }
+  static vector countr_zero(const vector value)
+  {
+    // The exponent of the lowest set bit converted to float, in the 32-bit half of the lane that holds it (a zero half yields zero).
+    const auto lowest   = _mm_and_si128(value, _mm_sub_epi64(_mm_setzero_si128(), value));
+    const auto exponent = _mm_and_si128(_mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(lowest)), 23), _mm_set1_epi32(0xFF));
+    const auto high     = _mm_srli_epi64(exponent, 32);
+    const auto offset   = _mm_andnot_si128(zero(high), _mm_set1_epi64x(32));
+    return _mm_sub_epi64(_mm_add_epi64(_mm_add_epi64(_mm_and_si128(exponent, _mm_set1_epi64x(0xFF)), high), offset), _mm_set1_epi64x(127));
+  }
+  static vector minimum   (const vector lhs, const vector rhs)          { return select(negative(_mm_sub_epi64(lhs, rhs)), lhs, rhs); }
+  static vector maximum   (const vector lhs, const vector rhs)          { return select(negative(_mm_sub_epi64(lhs, rhs)), rhs, lhs); }
+  static mask   negative  (const vector value)                          { return _mm_shuffle_epi32(_mm_srai_epi32(value, 31), _MM_SHUFFLE(3, 3, 1, 1)); }
+  static mask   zero      (const vector value)
+  {
+    const auto equal = _mm_cmpeq_epi32(value, _mm_setzero_si128());
+    return _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+  }
+  static bool   all       (const mask   value)                          { return _mm_movemask_epi8(value) == 0xFFFF; }
+  static vector select    (const mask condition, const vector lhs, const vector rhs) { return _mm_or_si128(_mm_and_si128(condition, lhs), _mm_andnot_si128(condition, rhs)); }
+};
+#endif
+
+#if defined(__AVX2__)
+// Four lanes with AVX2.
+struct avx2
+{
+  using vector = __m256i;
+  using mask   = __m256i;
+  static constexpr std::size_t lanes = 4;
+
+  static vector load      (const std::int32_t* source)                  { return _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source))); }
+  static void   store     (std::int32_t* target, const vector value)
+  {
+    const auto packed = _mm256_permutevar8x32_epi32(value, _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(target), _mm256_castsi256_si128(packed));
+  }
+  static vector broadcast (const std::int64_t value)                    { return _mm256_set1_epi64x(value); }
+  static vector add       (const vector lhs, const vector rhs)          { return _mm256_add_epi64(lhs, rhs); }
+  static vector subtract  (const vector lhs, const vector rhs)          { return _mm256_sub_epi64(lhs, rhs); }
+  static vector multiply  (const vector lhs, const vector rhs)          { return _mm256_mul_epi32(lhs, rhs); }
+  static vector multiply_low(const vector lhs, const vector rhs)        { return _mm256_mul_epu32(lhs, rhs); }
+  static vector bitwise_or(const vector lhs, const vector rhs)          { return _mm256_or_si256(lhs, rhs); }
+  static vector shift_right(const vector value, const vector count)     { return _mm256_srlv_epi64(value, count); }
+  static vector countr_zero(const vector value)
+  {
+    // See sse2::countr_zero.
+    const auto lowest   = _mm256_and_si256(value, _mm256_sub_epi64(_mm256_setzero_si256(), value));
+    const auto exponent = _mm256_and_si256(_mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(lowest)), 23), _mm256_set1_epi32(0xFF));
+    const auto high     = _mm256_srli_epi64(exponent, 32);
+    const auto offset   = _mm256_andnot_si256(zero(high), _mm256_set1_epi64x(32));
+    return _mm256_sub_epi64(_mm256_add_epi64(_mm256_add_epi64(_mm256_and_si256(exponent, _mm256_set1_epi64x(0xFF)), high), offset), _mm256_set1_epi64x(127));
+  }
+  static vector minimum   (const vector lhs, const vector rhs)          { return select(_mm256_cmpgt_epi64(lhs, rhs), rhs, lhs); }
+  static vector maximum   (const vector lhs, const vector rhs)          { return select(_mm256_cmpgt_epi64(lhs, rhs), lhs, rhs); }
+  static mask   negative  (const vector value)                          { return _mm256_cmpgt_epi64(_mm256_setzero_si256(), value); }
+  static mask   zero      (const vector value)                          { return _mm256_cmpeq_epi64(value, _mm256_setzero_si256()); }
+  static bool   all       (const mask   value)                          { return _mm256_movemask_epi8(value) == -1; }
+  static vector select    (const mask condition, const vector lhs, const vector rhs) { return _mm256_blendv_epi8(rhs, lhs, condition); }
+};
+#endif
+
+#if defined(__AVX512F__)
+// Eight lanes with AVX-512 (F, and CD for the trailing zero count where available). Masks are mask registers.
+struct avx512
+{
+  using vector = __m512i;
+  using mask   = __mmask8;
+  static constexpr std::size_t lanes = 8;
+
+  static vector load      (const std::int32_t* source)                  { return _mm512_cvtepi32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source))); }
+  static void   store     (std::int32_t* target, const vector value)    { _mm256_storeu_si256(reinterpret_cast<__m256i*>(target), _mm512_cvtepi64_epi32(value)); }
+  static vector broadcast (const std::int64_t value)                    { return _mm512_set1_epi64(value); }
+  static vector add       (const vector lhs, const vector rhs)          { return _mm512_add_epi64(lhs, rhs); }
+  static vector subtract  (const vector lhs, const vector rhs)          { return _mm512_sub_epi64(lhs, rhs); }
+  static vector multiply  (const vector lhs, const vector rhs)          { return _mm512_mul_epi32(lhs, rhs); }
+  static vector multiply_low(const vector lhs, const vector rhs)        { return _mm512_mul_epu32(lhs, rhs); }
+  static vector bitwise_or(const vector lhs, const vector rhs)          { return _mm512_or_si512(lhs, rhs); }
+  static vector shift_right(const vector value, const vector count)     { return _mm512_srlv_epi64(value, count); }
+  static vector countr_zero(const vector value)
+  {
+    const auto lowest = _mm512_and_si512(value, _mm512_sub_epi64(_mm512_setzero_si512(), value));
+#if defined(__AVX512CD__)
+    return _mm512_sub_epi64(_mm512_set1_epi64(63), _mm512_lzcnt_epi64(lowest));
+#else
+    // See sse2::countr_zero.
+    const auto exponent = _mm512_and_si512(_mm512_srli_epi32(_mm512_castps_si512(_mm512_cvtepi32_ps(lowest)), 23), _mm512_set1_epi32(0xFF));
+    const auto high     = _mm512_srli_epi64(exponent, 32);
+    const auto offset   = _mm512_maskz_mov_epi64(_mm512_test_epi64_mask(high, high), _mm512_set1_epi64(32));
+    return _mm512_sub_epi64(_mm512_add_epi64(_mm512_add_epi64(_mm512_and_si512(exponent, _mm512_set1_epi64(0xFF)), high), offset), _mm512_set1_epi64(127));
+#endif
+  }
+  static vector minimum   (const vector lhs, const vector rhs)          { return _mm512_min_epi64(lhs, rhs); }
+  static vector maximum   (const vector lhs, const vector rhs)          { return _mm512_max_epi64(lhs, rhs); }
+  static mask   negative  (const vector value)                          { return _mm512_cmplt_epi64_mask(value, _mm512_setzero_si512()); }
+  static mask   zero      (const vector value)                          { return _mm512_testn_epi64_mask(value, value); }
+  static bool   all       (const mask   value)                          { return value == mask(0xFF); }
+  static vector select    (const mask condition, const vector lhs, const vector rhs) { return _mm512_mask_blend_epi64(condition, rhs, lhs); }
+};
+#endif
+
+// Two vectors of an instruction set processed side by side. The gcd loop is bound by the latency of its dependency chain, which an
+// independent chain interleaved with it hides.
+template <typename isa>
+struct unrolled
+{
+  struct vector { typename isa::vector first, second; };
+  struct mask   { typename isa::mask   first, second; };
+  static constexpr std::size_t lanes = 2 * isa::lanes;
+
+  static vector load      (const std::int32_t* source)                  { return {isa::load(source), isa::load(source + isa::lanes)}; }
+  static void   store     (std::int32_t* target, const vector value)    { isa::store(target, value.first); isa::store(target + isa::lanes, value.second); }
+  static vector broadcast (const std::int64_t value)                    { return {isa::broadcast(value), isa::broadcast(value)}; }
+  static vector add       (const vector lhs, const vector rhs)          { return {isa::add         (lhs.first, rhs.first), isa::add         (lhs.second, rhs.second)}; }
+  static vector subtract  (const vector lhs, const vector rhs)          { return {isa::subtract    (lhs.first, rhs.first), isa::subtract    (lhs.second, rhs.second)}; }
+  static vector multiply  (const vector lhs, const vector rhs)          { return {isa::multiply    (lhs.first, rhs.first), isa::multiply    (lhs.second, rhs.second)}; }
+  static vector multiply_low(const vector lhs, const vector rhs)        { return {isa::multiply_low(lhs.first, rhs.first), isa::multiply_low(lhs.second, rhs.second)}; }
+  static vector bitwise_or(const vector lhs, const vector rhs)          { return {isa::bitwise_or  (lhs.first, rhs.first), isa::bitwise_or  (lhs.second, rhs.second)}; }
+  static vector shift_right(const vector value, const vector count)     { return {isa::shift_right (value.first, count.first), isa::shift_right(value.second, count.second)}; }
+  static vector countr_zero(const vector value)                         { return {isa::countr_zero (value.first), isa::countr_zero(value.second)}; }
+  static vector minimum   (const vector lhs, const vector rhs)          { return {isa::minimum     (lhs.first, rhs.first), isa::minimum     (lhs.second, rhs.second)}; }
+  static vector maximum   (const vector lhs, const vector rhs)          { return {isa::maximum     (lhs.first, rhs.first), isa::maximum     (lhs.second, rhs.second)}; }
+  static mask   negative  (const vector value)                          { return {isa::negative    (value.first), isa::negative(value.second)}; }
+  static mask   zero      (const vector value)                          { return {isa::zero        (value.first), isa::zero    (value.second)}; }
+  static bool   all       (const mask   value)                          { return isa::all(value.first) && isa::all(value.second); }
+  static vector select    (const mask condition, const vector lhs, const vector rhs) { return {isa::select(condition.first, lhs.first, rhs.first), isa::select(condition.second, lhs.second, rhs.second)}; }
+};
+
+// The widest instruction set enabled at compile time (e.g. with -march=native or -mavx2), four vectors side by side. The emulation of
+// the 64-bit primitives costs SSE2 more than its two lanes gain over the scalar kernel (see benchmarks/simd_benchmark.cpp), hence
+// the x86-64 baseline falls back to the latter.
+#if   defined(__AVX512F__)
+using native = unrolled<unrolled<avx512>>;
+#elif defined(__AVX2__)
+using native = unrolled<unrolled<avx2  >>;
+#else
+using native = scalar;
+#endif
+
+// Canonizes the 64-bit fractions n/d (non-zero d, |n| and |d| below 2^63) with a vectorized binary gcd, and returns them truncated
+// to 32 bits. The division by the gcd 2^k g (g odd) is exact, hence is a shift by k followed by a multiplication with the inverse of g
+// modulo 2^32 (which suffices for the truncated result).
+template <typename isa>
+void canonize_lanes(typename isa::vector numerator, typename isa::vector denominator, std::int32_t* numerator_target, std::int32_t* denominator_target)
+{
+  // Move the sign to the numerator, and continue with its magnitude.
+  const auto negative_denominator = isa::negative(denominator);
+  numerator   = isa::select(negative_denominator, isa::subtract(isa::broadcast(0), numerator), numerator);
+  denominator = isa::select(negative_denominator, isa::subtract(isa::broadcast(0), denominator), denominator);
+  const auto negative  = isa::negative(numerator);
+  const auto magnitude = isa::select(negative, isa::subtract(isa::broadcast(0), numerator), numerator);
+
+  // gcd(0, d) = d, and 0/d canonizes to 0/1.
+  const auto zero  = isa::zero(magnitude);
+  auto       lhs   = isa::select(zero, denominator, magnitude);
+  auto       rhs   = denominator;
+  const auto shift = isa::countr_zero(isa::bitwise_or(lhs, rhs));
+  lhs = isa::shift_right(lhs, isa::countr_zero(lhs));
+  while (true)
+  {
+    rhs = isa::shift_right(rhs, isa::countr_zero(rhs));
+    const auto done    = isa::zero(rhs);
+    const auto minimum = isa::minimum(lhs, rhs);
+    rhs = isa::select(done, rhs, isa::subtract(isa::maximum(lhs, rhs), minimum));
+    lhs = isa::select(done, lhs, minimum);
+    if (isa::all(isa::zero(rhs)))
+      break;
+  }
+
+  // Newton's iteration for the inverse of an odd integer doubles the number of correct low bits, starting from 3 (x = g).
+  auto inverse = lhs;
+  for (auto i = 0; i < 4; ++i)
+    inverse = isa::multiply_low(inverse, isa::subtract(isa::broadcast(2), isa::multiply_low(lhs, inverse)));
+
+  auto result_numerator   = isa::multiply_low(isa::shift_right(magnitude  , shift), inverse);
+  auto result_denominator = isa::multiply_low(isa::shift_right(denominator, shift), inverse);
+  result_numerator   = isa::select(negative, isa::subtract(isa::broadcast(0), result_numerator), result_numerator);
+  result_numerator   = isa::select(zero    , isa::broadcast(0), result_numerator  );
+  result_denominator = isa::select(zero    , isa::broadcast(1), result_denominator);
+  isa::store(numerator_target  , result_numerator  );
+  isa::store(denominator_target, result_denominator);
+}
+
+// Applies the kernel to all elements, a vector of lanes at a time, and to the remaining elements one at a time.
+template <typename isa, typename kernel_type>
+void for_each(const std::size_t size, kernel_type&& kernel)
+{
+  std::size_t i = 0;
+  for (; i + isa::lanes <= size; i += isa::lanes)
+    kernel(isa(), i);
+  for (; i < size; ++i)
+    kernel(scalar(), i);
+}
+
+template <typename isa>
+void add      (const rational_span<std::int32_t>& result, const rational_span<const std::int32_t>& lhs, const rational_span<const std::int32_t>& rhs, const bool subtract)
+{
+  detail::simd::for_each<isa>(result.size(), [&] <typename lane_isa> (lane_isa, const std::size_t i)
+  {
+    // (a/b) +- (c/d) = (ad +- cb)/(bd), exact in 64 bits.
+    const auto a = lane_isa::load(&lhs.numerators[i]), b = lane_isa::load(&lhs.denominators[i]);
+    const auto c = lane_isa::load(&rhs.numerators[i]), d = lane_isa::load(&rhs.denominators[i]);
+    const auto ad = lane_isa::multiply(a, d);
+    const auto cb = lane_isa::multiply(c, b);
+    detail::simd::canonize_lanes<lane_isa>(subtract ? lane_isa::subtract(ad, cb) : lane_isa::add(ad, cb), lane_isa::multiply(b, d), &result.numerators[i], &result.denominators[i]);
+  });
+}
+template <typename isa>
+void multiply (const rational_span<std::int32_t>& result, const rational_span<const std::int32_t>& lhs, const rational_span<const std::int32_t>& rhs)
+{
+  detail::simd::for_each<isa>(result.size(), [&] <typename lane_isa> (lane_isa, const std::size_t i)
+  {
+    const auto a = lane_isa::load(&lhs.numerators[i]), b = lane_isa::load(&lhs.denominators[i]);
+    const auto c = lane_isa::load(&rhs.numerators[i]), d = lane_isa::load(&rhs.denominators[i]);
+    detail::simd::canonize_lanes<lane_isa>(lane_isa::multiply(a, c), lane_isa::multiply(b, d), &result.numerators[i], &result.denominators[i]);
+  });
+}
+template <typename isa>
+void compare  (const std::span<std::int32_t>& result, const rational_span<const std::int32_t>& lhs, const rational_span<const std::int32_t>& rhs)
+{
+  detail::simd::for_each<isa>(result.size(), [&] <typename lane_isa> (lane_isa, const std::size_t i)
+  {
+    // sign(ad - cb) for positive b and d, exact in 64 bits.
+    const auto a = lane_isa::load(&lhs.numerators[i]), b = lane_isa::load(&lhs.denominators[i]);
+    const auto c = lane_isa::load(&rhs.numerators[i]), d = lane_isa::load(&rhs.denominators[i]);
+    const auto difference = lane_isa::subtract(lane_isa::multiply(a, d), lane_isa::multiply(c, b));
+    const auto sign       = lane_isa::select(lane_isa::zero(difference), lane_isa::broadcast(0), lane_isa::broadcast(1));
+    lane_isa::store(&result[i], lane_isa::select(lane_isa::negative(difference), lane_isa::broadcast(-1), sign));
+  });
+}
+template <typename isa>
+void canonize (const rational_span<std::int32_t>& values)
+{
+  detail::simd::for_each<isa>(values.size(), [&] <typename lane_isa> (lane_isa, const std::size_t i)
+  {
+    detail::simd::canonize_lanes<lane_isa>(lane_isa::load(&values.numerators[i]), lane_isa::load(&values.denominators[i]), &values.numerators[i], &values.denominators[i]);
+  });
+}
+}
+
+// Batch operations on canonical rationals of 32-bit integers in structure-of-arrays layout, vectorized with the widest instruction
+// set enabled at compile time (AVX-512, AVX2, or none). The intermediate results are exact in 64 bits, hence the results are
+// exact (and canonical) whenever they fit 32 bits, and are truncated otherwise. The operands have at least as many elements as the
+// result, and the result may alias the operands.
+inline void rational_span_add      (const rational_span<std::int32_t>& result, const rational_span<const std::int32_t>& lhs, const rational_span<const std::int32_t>& rhs)
+{
+  detail::simd::add     <detail::simd::native>(result, lhs, rhs, false);
+}
+inline void rational_span_subtract (const rational_span<std::int32_t>& result, const rational_span<const std::int32_t>& lhs, const rational_span<const std::int32_t>& rhs)
+{
+  detail::simd::add     <detail::simd::native>(result, lhs, rhs, true );
+}
+inline void rational_span_multiply (const rational_span<std::int32_t>& result, const rational_span<const std::int32_t>& lhs, const rational_span<const std::int32_t>& rhs)
+{
+  detail::simd::multiply<detail::simd::native>(result, lhs, rhs);
+}
+// Writes -1, 0 or 1 for lhs < rhs, lhs == rhs and lhs > rhs respectively.
+inline void rational_span_compare  (const std::span<std::int32_t>& result, const rational_span<const std::int32_t>& lhs, const rational_span<const std::int32_t>& rhs)
+{
+  detail::simd::compare <detail::simd::native>(result, lhs, rhs);
+}
+// Brings arbitrary fractions with non-zero denominators into canonical form.
+inline void rational_span_canonize (const rational_span<std::int32_t>& values)
+{
+  detail::simd::canonize<detail::simd::native>(values);
+}
+}
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <std/experimental/rational.hpp>
+#include <std/experimental/rational_simd.hpp>
+
+namespace std::experimental
+{
+namespace detail
+{
+// Allocates storage aligned to the given boundary (a cache line by default, which covers the widest vector registers).
+template <typename type, std::size_t alignment = 64>
+struct aligned_allocator
+{
+  using value_type = type;
+
+  template <typename that_type>
+  struct rebind
+  {
+    using other = aligned_allocator<that_type, alignment>;
+  };
+
+  constexpr aligned_allocator() noexcept = default;
+  template <typename that_type>
+  constexpr aligned_allocator(const aligned_allocator<that_type, alignment>&) noexcept { }
+
+  [[nodiscard]]
+  type* allocate  (const std::size_t size)
+  {
+    return static_cast<type*>(::operator new(size * sizeof(type), std::align_val_t(alignment)));
+  }
+  void  deallocate(type* pointer, const std::size_t size) noexcept
+  {
+    ::operator delete(pointer, size * sizeof(type), std::align_val_t(alignment));
+  }
+
+  template <typename that_type>
+  constexpr bool operator==(const aligned_allocator<that_type, alignment>&) const noexcept
+  {
+    return true;
+  }
+};
+}
+
+// A sequence container of rationals in structure-of-arrays layout: The numerators and the denominators are stored in two separate
+// aligned arrays, which allows loops over the container (and the batch operations of rational_simd.hpp) to be vectorized. The
+// elements are accessed through proxy references, which convert to and assign from rational<type, policy>. The constant iterators
+// yield the rationals themselves, for algorithms that apply the (template) operators of rational to the elements.
+template <integral type, overflow_policy policy = unchecked_policy>
+class rational_vector
+{
+public:
+  using value_type      = rational<type, policy>;
+  using size_type       = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using storage_type    = std::vector<type, detail::aligned_allocator<type>>;
+
+  // Refers to the numerator and the denominator of an element.
+  class reference
+  {
+  public:
+    constexpr reference  (type* numerator, type* denominator) : numerator_(numerator), denominator_(denominator)
+    {
+
+    }
+    constexpr reference  (const reference&  that) = default;
+    constexpr ~reference ()                       = default;
+
+    constexpr reference& operator=(const value_type& value)
+    {
+      *numerator_   = value.numerator  ();
+      *denominator_ = value.denominator();
+      return *this;
+    }
+    constexpr reference& operator=(const reference&  that)
+    {
+      return *this = static_cast<value_type>(that);
+    }
+    // Writes through a constant proxy, as std::indirectly_writable requires.
+    constexpr const reference& operator=(const value_type& value) const
+    {
+      *numerator_   = value.numerator  ();
+      *denominator_ = value.denominator();
+      return *this;
+    }
+
+    // The stored values are canonical (see normalize), hence are read without a gcd.
+    constexpr operator value_type() const
+    {
+      return value_type(canonical, *numerator_, *denominator_);
+    }
+
+    constexpr reference& operator+=(const value_type& that) { return *this = static_cast<value_type>(*this) += that; }
+    constexpr reference& operator-=(const value_type& that) { return *this = static_cast<value_type>(*this) -= that; }
+    constexpr reference& operator*=(const value_type& that) { return *this = static_cast<value_type>(*this) *= that; }
+    constexpr reference& operator/=(const value_type& that) { return *this = static_cast<value_type>(*this) /= that; }
+
+    [[nodiscard]]
+    constexpr type numerator  () const
+    {
+      return *numerator_;
+    }
+    [[nodiscard]]
+    constexpr type denominator() const
+    {
+      return *denominator_;
+    }
+
+    friend constexpr bool                 operator== (const reference& lhs, const value_type& rhs)
+    {
+      return static_cast<value_type>(lhs) == rhs;
+    }
+    friend constexpr std::strong_ordering operator<=>(const reference& lhs, const value_type& rhs)
+    {
+      return static_cast<value_type>(lhs) <=> rhs;
+    }
+    friend constexpr type                 numerator  (const reference& value)
+    {
+      return value.numerator  ();
+    }
+    friend constexpr type                 denominator(const reference& value)
+    {
+      return value.denominator();
+    }
+    friend constexpr void                 swap       (reference lhs, reference rhs)
+    {
+      const value_type temp = lhs;
+      lhs = static_cast<value_type>(rhs);
+      rhs = temp;
+    }
+
+  protected:
+    type* numerator_  ;
+    type* denominator_;
+  };
+
+  // Random access iterator over the proxy references (or the values, if constant).
+  template <bool constant>
+  class basic_iterator
+  {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = rational_vector::value_type;
+    using difference_type   = rational_vector::difference_type;
+    using reference         = std::conditional_t<constant, value_type, rational_vector::reference>;
+    using pointer           = void;
+    using container_type    = std::conditional_t<constant, const rational_vector, rational_vector>;
+
+    constexpr basic_iterator() = default;
+    constexpr basic_iterator(container_type* container, const difference_type index) : container_(container), index_(index)
+    {
+
+    }
+    constexpr operator basic_iterator<true>() const requires (!constant)
+    {
+      return {container_, index_};
+    }
+
+    constexpr reference       operator*  () const                        { return (*container_)[static_cast<size_type>(index_)]; }
+    constexpr reference       operator[] (const difference_type n) const { return *(*this + n); }
+
+    constexpr basic_iterator& operator++ ()                              { ++index_; return *this; }
+    constexpr basic_iterator& operator-- ()                              { --index_; return *this; }
+    constexpr basic_iterator  operator++ (int)                           { auto result = *this; ++index_; return result; }
+    constexpr basic_iterator  operator-- (int)                           { auto result = *this; --index_; return result; }
+    constexpr basic_iterator& operator+= (const difference_type n)       { index_ += n; return *this; }
+    constexpr basic_iterator& operator-= (const difference_type n)       { index_ -= n; return *this; }
+
+    friend constexpr basic_iterator  operator+  (basic_iterator iterator, const difference_type n) { return iterator += n; }
+    friend constexpr basic_iterator  operator+  (const difference_type n, basic_iterator iterator) { return iterator += n; }
+    friend constexpr basic_iterator  operator-  (basic_iterator iterator, const difference_type n) { return iterator -= n; }
+    friend constexpr difference_type operator-  (const basic_iterator& lhs, const basic_iterator& rhs) { return lhs.index_ - rhs.index_; }
+    friend constexpr bool            operator== (const basic_iterator& lhs, const basic_iterator& rhs) { return lhs.index_ == rhs.index_; }
+    friend constexpr auto            operator<=>(const basic_iterator& lhs, const basic_iterator& rhs) { return lhs.index_ <=> rhs.index_; }
+
+    // Customizations of std::ranges::iter_move and std::ranges::iter_swap for the proxy references.
+    friend constexpr value_type      iter_move  (const basic_iterator& iterator)                   { return *iterator; }
+    friend constexpr void            iter_swap  (const basic_iterator& lhs, const basic_iterator& rhs) requires (!constant) { swap(*lhs, *rhs); }
+
+  protected:
+    container_type* container_ = nullptr;
+    difference_type index_     = 0;
+  };
+  using iterator       = basic_iterator<false>;
+  using const_iterator = basic_iterator<true >;
+
+  // Constructors and destructor.
+  constexpr rational_vector         ()                             = default;
+  constexpr explicit rational_vector(const size_type size, const value_type& value = value_type())
+  : numerators_(size, value.numerator()), denominators_(size, value.denominator())
+  {
+
+  }
+  constexpr rational_vector         (const std::initializer_list<value_type> values)
+  {
+    reserve(values.size());
+    for (const auto& value : values)
+      push_back(value);
+  }
+  template <std::input_iterator iterator_type>
+  constexpr rational_vector         (iterator_type first, const iterator_type last)
+  {
+    for (; first != last; ++first)
+      push_back(*first);
+  }
+  constexpr rational_vector         (const rational_vector&  that) = default;
+  constexpr rational_vector         (      rational_vector&& temp) = default;
+  constexpr ~rational_vector        ()                             = default;
+
+  // Assignment operators.
+  constexpr rational_vector& operator=(const rational_vector&  that) = default;
+  constexpr rational_vector& operator=(      rational_vector&& temp) = default;
+
+  // Element access.
+  constexpr reference  operator[] (const size_type index)
+  {
+    return {numerators_.data() + index, denominators_.data() + index};
+  }
+  constexpr value_type operator[] (const size_type index) const
+  {
+    return load(index);
+  }
+
+  // The underlying arrays. Writing to them through span() may break the canonical form, hence must be followed by normalize() before
+  // the elements are read again.
+  constexpr std::span<const type> numerators  () const { return numerators_  ; }
+  constexpr std::span<const type> denominators() const { return denominators_; }
+  constexpr rational_span<type>       span    ()       { return {numerators_, denominators_}; }
+  constexpr rational_span<const type> span    () const { return {numerators_, denominators_}; }
+
+  // Iterators.
+  constexpr iterator       begin ()       { return {this, 0}; }
+  constexpr iterator       end   ()       { return {this, static_cast<difference_type>(size())}; }
+  constexpr const_iterator begin () const { return {this, 0}; }
+  constexpr const_iterator end   () const { return {this, static_cast<difference_type>(size())}; }
+  constexpr const_iterator cbegin() const { return begin(); }
+  constexpr const_iterator cend  () const { return end  (); }
+
+  // Capacity.
+  [[nodiscard]]
+  constexpr bool      empty   () const { return numerators_.empty(); }
+  constexpr size_type size    () const { return numerators_.size (); }
+  constexpr size_type capacity() const { return numerators_.capacity(); }
+  constexpr void      reserve (const size_type capacity)
+  {
+    numerators_  .reserve(capacity);
+    denominators_.reserve(capacity);
+  }
+
+  // Modifiers.
+  constexpr void      clear     ()
+  {
+    numerators_  .clear();
+    denominators_.clear();
+  }
+  constexpr void      push_back (const value_type& value)
+  {
+    numerators_  .push_back(value.numerator  ());
+    denominators_.push_back(value.denominator());
+  }
+  constexpr void      pop_back  ()
+  {
+    numerators_  .pop_back();
+    denominators_.pop_back();
+  }
+  constexpr void      resize    (const size_type size, const value_type& value = value_type())
+  {
+    numerators_  .resize(size, value.numerator  ());
+    denominators_.resize(size, value.denominator());
+  }
+
+  // Bulk operations.
+  // Multiplies all elements by the factor.
+  constexpr void       scale    (const value_type& factor)
+  {
+    for (size_type i = 0; i < size(); ++i)
+      store(i, load(i) * factor);
+  }
+  // Adds the addend to all elements. Integers take the gcd-free path of rational::operator+=, which vectorizes.
+  constexpr void       add      (const value_type& addend)
+  {
+    if (addend.denominator() == type(1))
+      for (size_type i = 0; i < size(); ++i)
+        store(i, load(i) += addend.numerator());
+    else
+      for (size_type i = 0; i < size(); ++i)
+        store(i, load(i) +  addend);
+  }
+  // Brings the elements into canonical form after direct writes to the underlying arrays (the denominators must not be zero).
+  constexpr void       normalize()
+  {
+    if constexpr (std::is_same_v<type, std::int32_t> && std::is_same_v<policy, unchecked_policy>)
+      if (!std::is_constant_evaluated())
+      {
+        rational_span_canonize(span());
+        return;
+      }
+
+    for (size_type i = 0; i < size(); ++i)
+      store(i, value_type(numerators_[i], denominators_[i]));
+  }
+  // The sum of all elements.
+  [[nodiscard]]
+  constexpr value_type reduce   () const
+  {
+    value_type result;
+    for (size_type i = 0; i < size(); ++i)
+      result += load(i);
+    return result;
+  }
+
+protected:
+  // Reads an element without a gcd, as reference::operator value_type.
+  constexpr value_type load (const size_type index) const
+  {
+    return value_type(canonical, numerators_[index], denominators_[index]);
+  }
+  constexpr void       store(const size_type index, const value_type& value)
+  {
+    numerators_  [index] = value.numerator  ();
+    denominators_[index] = value.denominator();
+  }
+
+  storage_type numerators_  ;
+  storage_type denominators_;
+};
+}
@@ -0,0 +1,124 @@
+#include "internal/doctest.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include <std/experimental/big_integer.hpp>
+
+TEST_CASE("std::experimental::big_integer")
+{
+  using big_integer = std::experimental::big_integer;
+
+  const auto parse = [ ] (const std::string& text)
+  {
+    big_integer result;
+    std::istringstream(text) >> result;
+    return result;
+  };
+
+  // Against the built-in 128-bit arithmetic.
+  std::mt19937_64 generator(0);
+  for (auto i = 0; i < 100000; ++i)
+  {
+    const auto lhs = static_cast<__int128>(static_cast<std::int64_t>(generator() >> generator() % 64)) * static_cast<std::int64_t>(generator() >> generator() % 64);
+    const auto rhs = static_cast<__int128>(static_cast<std::int64_t>(generator() >> generator() % 64)) | 1;
+    REQUIRE((static_cast<__int128>(big_integer(lhs) + big_integer(rhs)) == lhs + rhs));
+    REQUIRE((static_cast<__int128>(big_integer(lhs) - big_integer(rhs)) == lhs - rhs));
+    REQUIRE((static_cast<__int128>(big_integer(lhs) / big_integer(rhs)) == lhs / rhs));
+    REQUIRE((static_cast<__int128>(big_integer(lhs) % big_integer(rhs)) == lhs % rhs));
+    REQUIRE((static_cast<__int128>(big_integer(static_cast<std::int64_t>(lhs)) * big_integer(rhs)) == static_cast<std::int64_t>(lhs) * rhs));
+    REQUIRE(((big_integer(lhs) <=> big_integer(rhs)) == (lhs <=> rhs)));
+  }
+
+  // Beyond: Division, gcd and stream round trip.
+  const auto lhs = parse("-123456789012345678901234567890123456789012345678901234567890");
+  const auto rhs = parse("98765432109876543210987654321");
+  REQUIRE(lhs / rhs * rhs + lhs % rhs == lhs);
+  REQUIRE(lhs / rhs == parse("-1249999988609375000142382812499"));
+  REQUIRE(lhs % rhs == parse("-46440971104644097110464409711"));
+  REQUIRE(gcd(lhs * 1001, rhs * 1001) == gcd(lhs, rhs) * 1001);
+  REQUIRE(((big_integer(1) << 100) >> 99) == 2);
+
+  std::ostringstream stream;
+  stream << lhs * rhs;
+  REQUIRE(stream.str() == "-12193263113702179522618503273374485596337448559633744855963362292333223746380111126352690");
+  REQUIRE(parse(stream.str()) == lhs * rhs);
+}
+
+TEST_CASE("std::experimental::rational<big_integer>")
+{
+  using big_integer = std::experimental::big_integer;
+  using rational    = std::experimental::rational<big_integer>;
+
+  static_assert(std::experimental::integral<big_integer>);
+
+  // The 100th harmonic number does not fit 128 bits.
+  rational harmonic;
+  for (auto i = 1; i <= 100; ++i)
+    harmonic += rational(1, i);
+
+  std::ostringstream stream;
+  stream << harmonic;
+  REQUIRE(stream.str() == "14466636279520351160221518043104131447711/2788815009188499086581352357412492142272");
+
+  rational parsed;
+  std::istringstream(stream.str()) >> parsed;
+  REQUIRE(parsed == harmonic);
+
+  // Wallis product, canonical after each step.
+  rational product(1);
+  for (auto i = 1; i <= 30; ++i)
+    product *= rational(2 * i, 2 * i - 1);
+  REQUIRE(product == rational(big_integer(72057594037927936), big_integer(7391536347803839)));
+
+  REQUIRE(harmonic > rational(5)      );
+  REQUIRE(harmonic < rational(26, 5)  );
+  REQUIRE(-harmonic + harmonic == 0   );
+  REQUIRE(harmonic / harmonic  == 1   );
+  REQUIRE(pow(rational(2, 3), big_integer(-100)) == rational(pow(rational(3, 2), big_integer(100))));
+}
+
+TEST_CASE("std::experimental::rational<big_integer> conversions")
+{
+  using big_integer = std::experimental::big_integer;
+  using rational    = std::experimental::rational<big_integer>;
+
+  // Floating point values convert exactly, however small or large.
+  REQUIRE(rational( 0.5 ) == rational(1, 2));
+  REQUIRE(rational(-0.1f) == rational(-13421773, 134217728));
+  REQUIRE(rational(std::numeric_limits<double>::denorm_min()).denominator().bit_width() == 1075);
+  REQUIRE(rational(std::numeric_limits<double>::max       ()).numerator  ().bit_width() == 1024);
+#if defined(__cpp_lib_expected)
+  REQUIRE(rational::make(0.5).value() == rational(1, 2));
+  REQUIRE(rational::make(std::numeric_limits<double>::infinity()).error() == std::experimental::rational_errc::not_finite);
+#endif
+
+  // Evaluation is correctly rounded in the given direction.
+  REQUIRE(rational(1, 3).evaluate<double>() == 1.0 / 3.0);
+  REQUIRE(rational(1, 3).to_float(std::round_toward_zero) < rational(1, 3).to_float(std::round_toward_infinity));
+  REQUIRE(rational(big_integer(1), big_integer(1) << 1074).to_double() == std::numeric_limits<double>::denorm_min());
+  std::mt19937_64 generator(0);
+  std::uniform_int_distribution<std::int64_t> numerators(-(std::int64_t(1) << 53), std::int64_t(1) << 53);
+  std::uniform_int_distribution<int>          exponents (-1000, 900);
+  for (auto i = 0; i < 1000; ++i)
+  {
+    const auto value = std::ldexp(static_cast<double>(numerators(generator)), exponents(generator));
+    REQUIRE(rational(value).to_double() == value);
+  }
+
+  // Approximation and character conversion.
+  REQUIRE(rational(314159, 100000).limit_denominator(big_integer(100)) == rational(311, 99));
+  REQUIRE(rational::approximate(3.14159, 1000) == rational(355, 113));
+
+  constexpr std::string_view text = "-123456789012345678901234567890.5";
+  rational parsed;
+  REQUIRE(from_chars(text.data(), text.data() + text.size(), parsed).ec == std::errc());
+  std::ostringstream stream;
+  stream << parsed;
+  REQUIRE(stream.str() == "-246913578024691357802469135781/2");
+}
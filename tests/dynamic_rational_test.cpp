@@ -0,0 +1,63 @@
+#include "internal/doctest.h"
+
+#include <cstdint>
+#include <random>
+#include <sstream>
+
+#include <std/experimental/dynamic_rational.hpp>
+
+TEST_CASE("std::experimental::dynamic_rational")
+{
+  using dynamic_rational = std::experimental::dynamic_rational;
+  using small_type       = dynamic_rational::small_type;
+  using large_type       = dynamic_rational::large_type;
+  using big_integer      = std::experimental::big_integer;
+
+  // Values that fit stay inline, and agree with the rationals of 64-bit integers.
+  std::mt19937                                generator(0);
+  std::uniform_int_distribution<std::int64_t> numerators  (-1000, 1000);
+  std::uniform_int_distribution<std::int64_t> denominators(1    , 1000);
+  for (auto i = 0; i < 10000; ++i)
+  {
+    const small_type lhs(numerators(generator), denominators(generator)), rhs(numerators(generator), denominators(generator));
+    REQUIRE((dynamic_rational(lhs) + dynamic_rational(rhs)).is_inline());
+    REQUIRE(static_cast<small_type>(dynamic_rational(lhs) + dynamic_rational(rhs)) == lhs + rhs);
+    REQUIRE(static_cast<small_type>(dynamic_rational(lhs) - dynamic_rational(rhs)) == lhs - rhs);
+    REQUIRE(static_cast<small_type>(dynamic_rational(lhs) * dynamic_rational(rhs)) == lhs * rhs);
+    if (rhs != small_type(0))
+      REQUIRE(static_cast<small_type>(dynamic_rational(lhs) / dynamic_rational(rhs)) == lhs / rhs);
+    REQUIRE((dynamic_rational(lhs) <=> dynamic_rational(rhs)) == (lhs <=> rhs));
+  }
+
+  // The 100th harmonic number is promoted, and agrees with the rational of big integers.
+  dynamic_rational harmonic;
+  large_type       expected;
+  for (auto i = 1; i <= 100; ++i)
+  {
+    harmonic += dynamic_rational(1, i);
+    expected += large_type(1, i);
+  }
+  REQUIRE(!harmonic.is_inline());
+  REQUIRE(static_cast<large_type>(harmonic) == expected);
+  REQUIRE(harmonic > dynamic_rational(5));
+
+  std::ostringstream stream;
+  stream << harmonic;
+  REQUIRE(stream.str() == "14466636279520351160221518043104131447711/2788815009188499086581352357412492142272");
+  REQUIRE_THROWS_AS(static_cast<void>(static_cast<small_type>(harmonic)), std::overflow_error);
+
+  // Demoted once the value fits again.
+  auto difference = harmonic - (harmonic - dynamic_rational(1, 3));
+  REQUIRE(difference.is_inline());
+  REQUIRE(difference == dynamic_rational(1, 3));
+
+  // Overflow of the inline arithmetic promotes.
+  const dynamic_rational maximum(std::numeric_limits<std::int64_t>::max());
+  auto sum = maximum + maximum;
+  REQUIRE(!sum.is_inline());
+  REQUIRE(sum.numerator() == big_integer(std::numeric_limits<std::int64_t>::max()) * 2);
+  REQUIRE((sum / dynamic_rational(2)).is_inline());
+  REQUIRE(sum / dynamic_rational(2) == maximum);
+  REQUIRE(dynamic_rational(std::numeric_limits<std::int64_t>::min()) == -(dynamic_rational(std::numeric_limits<std::int64_t>::max()) + dynamic_rational(1)));
+  REQUIRE_THROWS_AS(static_cast<void>(harmonic / dynamic_rational()), std::domain_error);
+}
@@ -0,0 +1,76 @@
+#include "internal/doctest.h"
+
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+#include <std/experimental/fixed_rational.hpp>
+
+template <typename ratio_type, typename type>
+concept ratio_convertible = requires { std::experimental::to_rational<ratio_type, type>(); };
+
+TEST_CASE("std::experimental::fixed_rational")
+{
+  using rational = std::experimental::rational<std::int64_t>;
+  using ticks    = std::experimental::fixed_rational<std::int64_t, 90000>;
+  using samples  = std::experimental::fixed_rational<std::int64_t, 48000>;
+  using frames   = std::experimental::fixed_rational<std::int64_t, 30>;
+
+  static_assert(sizeof(ticks) == sizeof(std::int64_t));
+  static_assert(std::is_same_v<ticks::period, std::ratio<1, 90000>>);
+
+  // Arithmetic on the numerator.
+  ticks value(45000);
+  value += ticks(3000);
+  value -= ticks(1000);
+  REQUIRE(value.numerator() == 47000);
+  REQUIRE((value * std::int64_t(3)).numerator() == 141000);
+  REQUIRE((std::int64_t(2) * -value) == ticks(-94000));
+  REQUIRE(ticks(1) < ticks(2));
+  // Negation is handled by the policy, as the other arithmetic.
+  using checked_ticks   = std::experimental::fixed_rational<std::int32_t, 90000, std::experimental::checked_throw_policy>;
+  using saturated_ticks = std::experimental::fixed_rational<std::int32_t, 90000, std::experimental::checked_saturate_policy>;
+  constexpr auto minimum = std::numeric_limits<std::int32_t>::min();
+  REQUIRE((-checked_ticks(-5)).numerator() == 5);
+  REQUIRE_THROWS_AS(static_cast<void>(-checked_ticks(minimum)), std::overflow_error);
+  REQUIRE((-saturated_ticks(minimum)).numerator() == std::numeric_limits<std::int32_t>::max());
+
+  // Conversions to and from rational respect canonical form.
+  REQUIRE(static_cast<rational>(ticks(45000)) == rational(1, 2));
+  REQUIRE(static_cast<rational>(ticks(45000)).denominator() == 2);
+  REQUIRE(ticks(rational(1, 3)).numerator() == 30000);
+  REQUIRE(ticks(rational(-7, 9000)).numerator() == -70);
+  REQUIRE_THROWS_AS(static_cast<void>(ticks(rational(1, 7))), std::domain_error);
+  REQUIRE(ticks::make(rational(1, 7)).error() == std::experimental::rational_errc::not_representable);
+  REQUIRE(ticks::make(rational(1, 3)).value() == ticks(30000));
+  REQUIRE(value.evaluate<double>() == 47000.0 / 90000.0);
+
+  // Conversions between denominators: Implicit if exact for any value, checked otherwise.
+  static_assert( std::is_convertible_v<frames, ticks  >);
+  static_assert(!std::is_convertible_v<ticks , frames >);
+  static_assert(!std::is_convertible_v<ticks , samples>);
+  const ticks frame = frames(1);
+  REQUIRE(frame.numerator() == 3000);
+  REQUIRE(samples(ticks(45000)).numerator() == 24000);
+  REQUIRE_THROWS_AS(static_cast<void>(frames(ticks(1))), std::domain_error);
+
+  // Interoperation with std::ratio.
+  constexpr ticks millisecond = std::milli();
+  static_assert(millisecond.numerator() == 90);
+  static_assert(std::experimental::to_rational<std::ratio<6, 4>>() == std::experimental::rational<std::intmax_t>(3, 2));
+  // Ratios whose scaled numerator would not fit are rejected at compile time.
+  using centiseconds = std::experimental::fixed_rational<std::int16_t, 100>;
+  static_assert( std::is_constructible_v<centiseconds, std::ratio< 327>>);
+  static_assert(!std::is_constructible_v<centiseconds, std::ratio< 328>>);
+  static_assert(!std::is_constructible_v<centiseconds, std::ratio<1, 3>>);
+  static_assert(!std::is_constructible_v<std::experimental::fixed_rational<std::uint32_t, 10>, std::ratio<-1, 10>>);
+  static_assert( ratio_convertible<std::ratio<std::int64_t(1) << 30>, std::int32_t>);
+  static_assert(!ratio_convertible<std::ratio<std::int64_t(1) << 40>, std::int32_t>);
+
+  std::ostringstream stream;
+  stream << ticks(30000);
+  REQUIRE(stream.str() == "1/3");
+}
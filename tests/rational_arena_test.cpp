@@ -0,0 +1,66 @@
+#include "internal/doctest.h"
+
+#include <cstddef>
+#include <memory_resource>
+#include <sstream>
+
+#include <std/experimental/rational_arena.hpp>
+
+namespace
+{
+// Counts the allocations passed on to the default resource.
+class counting_resource : public std::pmr::memory_resource
+{
+public:
+  std::size_t allocations = 0;
+
+protected:
+  void* do_allocate  (const std::size_t bytes, const std::size_t alignment) override
+  {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void  do_deallocate(void* pointer, const std::size_t bytes, const std::size_t alignment) override
+  {
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+  bool  do_is_equal  (const std::pmr::memory_resource& that) const noexcept override
+  {
+    return this == &that;
+  }
+};
+}
+
+TEST_CASE("std::experimental::rational_arena")
+{
+  using rational = std::experimental::pmr::rational<>;
+
+  counting_resource upstream;
+  std::experimental::big_integer numerator, denominator;
+  {
+    std::experimental::rational_arena arena(1 << 20, &upstream);
+    const auto allocations = upstream.allocations;
+
+    for (auto batch = 0; batch < 3; ++batch)
+    {
+      rational harmonic;
+      for (auto i = 1; i <= 100; ++i)
+        harmonic += rational(1, i);
+
+      // All limbs, including those of the temporaries, are allocated from the arena, which the batches reuse.
+      REQUIRE(harmonic.numerator().get_allocator().resource() == arena.resource());
+      REQUIRE(upstream.allocations == allocations);
+
+      numerator   = std::experimental::big_integer(harmonic.numerator  ());
+      denominator = std::experimental::big_integer(harmonic.denominator());
+      arena.reset();
+    }
+  }
+
+  // Outside the arena the default resource is used again, and the converted results remain valid.
+  REQUIRE(std::experimental::pmr::big_integer(1).get_allocator().resource() == std::pmr::get_default_resource());
+
+  std::ostringstream stream;
+  stream << numerator << '/' << denominator;
+  REQUIRE(stream.str() == "14466636279520351160221518043104131447711/2788815009188499086581352357412492142272");
+}
@@ -0,0 +1,61 @@
+#define RATIONAL_EXPRESSION_TEMPLATES
+
+#include "internal/doctest.h"
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+
+#include <std/experimental/big_integer.hpp>
+#include <std/experimental/rational.hpp>
+
+TEST_CASE("std::experimental::rational_expression")
+{
+  using rational = std::experimental::rational<std::int64_t>;
+
+  // The operators on rationals build expressions, which are evaluated on conversion.
+  const rational a(1, 2), b(2, 3), c(3, 4), d(4, 5), e(5, 6);
+  static_assert(!std::is_same_v<decltype(a * b + c * d - e), rational>);
+  const rational x = a * b + c * d - e;
+  REQUIRE(x == rational(1, 10));
+  REQUIRE((a * b + c * d - e) == x);
+  REQUIRE((a / b - -(c + e)) == rational(7, 3));
+  REQUIRE((a * b + std::int64_t(2)) == rational(7, 3));
+  REQUIRE((std::int64_t(2) / (a - b)).numerator() == -12);
+  REQUIRE_THROWS_AS(static_cast<void>(rational(c / (a - a))), std::domain_error);
+
+  // Agrees with the evaluation operation by operation (compound assignment) on random operands.
+  std::mt19937                                generator(0);
+  std::uniform_int_distribution<std::int64_t> numerators  (-1000, 1000);
+  std::uniform_int_distribution<std::int64_t> denominators(1    , 1000);
+  for (auto i = 0; i < 10000; ++i)
+  {
+    const rational p(numerators(generator), denominators(generator)), q(numerators(generator), denominators(generator));
+    const rational r(numerators(generator), denominators(generator)), s(numerators(generator), denominators(generator));
+    rational expected = p, product = r;
+    expected *= q;
+    product  *= s;
+    expected += product;
+    expected -= p;
+    REQUIRE(rational(p * q + r * s - p) == expected);
+  }
+
+  // Intermediates that overflow unreduced are evaluated on canonical rationals, according to the overflow policy.
+  using checked = std::experimental::rational<std::int32_t, std::experimental::checked_throw_policy>;
+  const checked lhs(1 << 20, 531441), rhs(5, 1 << 20);
+  REQUIRE((lhs * rhs) == checked(5, 531441));
+  REQUIRE_THROWS_AS(static_cast<void>(checked(lhs * lhs)), std::overflow_error);
+  // The fused quotient is canonized by the policy as well, including the sign of the denominator -2^31.
+  const checked minimum(std::numeric_limits<std::int32_t>::min());
+  REQUIRE_THROWS_AS(static_cast<void>(checked(checked(1) / minimum)), std::overflow_error);
+  REQUIRE(checked(checked(2) / minimum) == checked(-1, 1 << 30));
+
+  // Unbounded integers never overflow.
+  using big_rational = std::experimental::rational<std::experimental::big_integer>;
+  big_rational harmonic(0);
+  for (auto i = 1; i <= 30; ++i)
+    harmonic = harmonic + big_rational(1, i) * big_rational(1, i + 1);
+  REQUIRE(harmonic == big_rational(30, 31));
+}
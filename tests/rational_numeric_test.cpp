@@ -0,0 +1,54 @@
+#include "internal/doctest.h"
+
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <std/experimental/rational_numeric.hpp>
+#include <std/experimental/rational_vector.hpp>
+
+TEST_CASE("std::experimental::rational_sum, rational_product, rational_dot")
+{
+  using rational = std::experimental::rational<std::int64_t>;
+
+  // Several blocks (and a partial one) of terms with small denominators.
+  std::mt19937                                generator(0);
+  std::uniform_int_distribution<std::int64_t> numerators  (-50, 50);
+  std::uniform_int_distribution<std::int64_t> denominators(1  , 12);
+
+  std::vector<rational> lhs(5000), rhs(5000);
+  for (std::size_t i = 0; i < lhs.size(); ++i)
+  {
+    lhs[i] = rational(numerators(generator), denominators(generator));
+    rhs[i] = rational(numerators(generator), denominators(generator));
+  }
+
+  const auto sum = std::accumulate(lhs.begin(), lhs.end(), rational());
+  REQUIRE(std::experimental::rational_sum(lhs.begin(), lhs.end()) == sum);
+  REQUIRE(std::experimental::rational_sum(std::execution::par      , lhs.begin(), lhs.end()) == sum);
+  REQUIRE(std::experimental::rational_sum(std::execution::par_unseq, lhs.begin(), lhs.end()) == sum);
+
+  const auto dot = std::inner_product(lhs.begin(), lhs.end(), rhs.begin(), rational());
+  REQUIRE(std::experimental::rational_dot(lhs.begin(), lhs.end(), rhs.begin()) == dot);
+  REQUIRE(std::experimental::rational_dot(std::execution::par, lhs.begin(), lhs.end(), rhs.begin()) == dot);
+
+  // Products of ratios and their inverses in pairs, whose canonical result stays small though the unreduced one does not.
+  std::vector<rational> factors;
+  for (std::int64_t i = 1; i <= 3000; ++i)
+  {
+    factors.emplace_back(i % 12 + 1, i % 7 + 1);
+    factors.emplace_back(i % 7 + 1, i % 12 + 1);
+  }
+  factors.emplace_back(3, 4);
+  REQUIRE(std::experimental::rational_product(factors.begin(), factors.end()) == rational(3, 4));
+  REQUIRE(std::experimental::rational_product(std::execution::par, factors.begin(), factors.end()) == rational(3, 4));
+
+  // Empty sequences, and sequences of proxies.
+  REQUIRE(std::experimental::rational_sum    (lhs.begin(), lhs.begin()) == rational(0));
+  REQUIRE(std::experimental::rational_product(lhs.begin(), lhs.begin()) == rational(1));
+
+  const std::experimental::rational_vector<std::int64_t> vector(lhs.begin(), lhs.end());
+  REQUIRE(std::experimental::rational_sum(std::execution::par, vector.begin(), vector.end()) == sum);
+}
@@ -0,0 +1,97 @@
+#include "internal/doctest.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <std/experimental/rational_simd.hpp>
+
+// Compares the kernels of an instruction set against the (truncated) canonical results of 64-bit rationals.
+template <typename isa>
+void check_batch_operations(const std::int32_t range)
+{
+  using reference = std::experimental::rational<std::int64_t>;
+
+  constexpr std::size_t size = 1003; // Not a multiple of the lanes, to cover the remaining elements.
+
+  std::mt19937                                generator(0);
+  std::uniform_int_distribution<std::int32_t> numerators  (-range, range);
+  std::uniform_int_distribution<std::int32_t> denominators(1     , range);
+
+  std::vector<std::int32_t> a(size), b(size), c(size), d(size), n(size), m(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const auto lhs = std::experimental::rational<std::int32_t>(numerators(generator), denominators(generator));
+    const auto rhs = std::experimental::rational<std::int32_t>(numerators(generator), denominators(generator));
+    a[i] = lhs.numerator(); b[i] = lhs.denominator();
+    c[i] = rhs.numerator(); d[i] = rhs.denominator();
+  }
+  const std::experimental::rational_span<const std::int32_t> lhs {a, b};
+  const std::experimental::rational_span<const std::int32_t> rhs {c, d};
+  const std::experimental::rational_span<std::int32_t>       result {n, m};
+
+  const auto require = [&] (const auto& operation)
+  {
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      const auto expected = operation(reference(a[i], b[i]), reference(c[i], d[i]));
+      REQUIRE(n[i] == static_cast<std::int32_t>(expected.numerator  ()));
+      REQUIRE(m[i] == static_cast<std::int32_t>(expected.denominator()));
+    }
+  };
+
+  std::experimental::detail::simd::add     <isa>(result, lhs, rhs, false);
+  require([ ] (const reference& x, const reference& y) { return x + y; });
+  std::experimental::detail::simd::add     <isa>(result, lhs, rhs, true );
+  require([ ] (const reference& x, const reference& y) { return x - y; });
+  std::experimental::detail::simd::multiply<isa>(result, lhs, rhs);
+  require([ ] (const reference& x, const reference& y) { return x * y; });
+
+  std::vector<std::int32_t> ordering(size);
+  std::experimental::detail::simd::compare <isa>(ordering, lhs, rhs);
+  for (std::size_t i = 0; i < size; ++i)
+    REQUIRE(ordering[i] == (reference(a[i], b[i]) < reference(c[i], d[i]) ? -1 : reference(a[i], b[i]) > reference(c[i], d[i]) ? 1 : 0));
+
+  // Arbitrary fractions, including zero numerators, negative denominators and the minimum of the integer type.
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    n[i] = i % 7 == 0 ? 0 : static_cast<std::int32_t>(generator());
+    m[i] = i % 5 == 0 ? std::numeric_limits<std::int32_t>::min() : static_cast<std::int32_t>(generator() | 1u) * (i % 2 ? 2 : 1);
+  }
+  const auto numerators_copy = n, denominators_copy = m;
+  std::experimental::detail::simd::canonize<isa>(result);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const auto expected = reference(numerators_copy[i], denominators_copy[i]);
+    REQUIRE(n[i] == static_cast<std::int32_t>(expected.numerator  ()));
+    REQUIRE(m[i] == static_cast<std::int32_t>(expected.denominator()));
+  }
+}
+
+TEST_CASE("std::experimental::rational batch operations")
+{
+  for (const auto range : {100, 1'000'000, std::numeric_limits<std::int32_t>::max()})
+  {
+    check_batch_operations<std::experimental::detail::simd::scalar>(range);
+#if defined(__SSE2__) || defined(_M_X64)
+    check_batch_operations<std::experimental::detail::simd::sse2  >(range);
+#endif
+#if defined(__AVX2__)
+    check_batch_operations<std::experimental::detail::simd::avx2  >(range);
+#endif
+#if defined(__AVX512F__)
+    check_batch_operations<std::experimental::detail::simd::avx512>(range);
+#endif
+    check_batch_operations<std::experimental::detail::simd::native>(range);
+  }
+
+  // The public interface, with the result aliasing an operand.
+  std::vector<std::int32_t> numerators {1, 1, -2, 5, 7}, denominators {2, 3, 3, 4, 1};
+  const std::experimental::rational_span<std::int32_t> values {numerators, denominators};
+  std::experimental::rational_span_add     (values, values, values);
+  REQUIRE(numerators   == std::vector<std::int32_t>{1, 2, -4, 5, 14});
+  REQUIRE(denominators == std::vector<std::int32_t>{1, 3, 3, 2, 1 });
+  std::experimental::rational_span_multiply(values, values, values);
+  REQUIRE(numerators   == std::vector<std::int32_t>{1, 4, 16, 25, 196});
+  REQUIRE(denominators == std::vector<std::int32_t>{1, 9, 9 , 4 , 1  });
+}
@@ -1,5 +1,14 @@
 #include "internal/doctest.h"
 
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+
 #include <std/experimental/rational.hpp>
 
 TEST_CASE("std::experimental::rational")
@@ -7,6 +16,585 @@ TEST_CASE("std::experimental::rational")
   REQUIRE(std::experimental::rational( 3, 2) >  std::experimental::rational( 1, 2));
   REQUIRE(std::experimental::rational(-3, 2) <  std::experimental::rational(-1, 2));
   REQUIRE(std::experimental::rational(-3, 2) == std::experimental::rational(-6, 4));
+  REQUIRE(std::experimental::rational(std::experimental::canonical, -3, 2) == std::experimental::rational(-6, 4));
 
   // TODO: More tests.
-}
\ No newline at end of file
+}
+
+TEST_CASE("std::experimental::rational addition and subtraction")
+{
+  using rational = std::experimental::rational<std::int32_t>;
+
+  REQUIRE(rational( 1, 6) + rational(1, 3) == rational( 1, 2));
+  REQUIRE(rational( 1, 6) - rational(1, 3) == rational(-1, 6));
+  REQUIRE(rational( 1, 2) + rational(1, 3) == rational( 5, 6));
+  REQUIRE(rational( 1, 4) - rational(1, 4) == rational( 0, 1));
+  REQUIRE((rational(1, 4) - rational(1, 4)).denominator() == 1);
+
+  // The intermediate bd = 2^40 * 15 would overflow 32 bits, the reduced result 1 / (2^17 * 15) does not.
+  REQUIRE(rational(1, 3 << 20) + rational(1, 5 << 20) == rational(1, 15 << 17));
+  REQUIRE(rational(1, 3 << 20) - rational(1, 5 << 20) == rational(1, 15 << 19));
+}
+
+TEST_CASE("std::experimental::rational multiplication and division")
+{
+  using rational = std::experimental::rational<std::int32_t>;
+
+  REQUIRE(rational( 2, 3) * rational( 9, 4) == rational( 3, 2));
+  REQUIRE(rational( 2, 3) / rational(-4, 9) == rational(-3, 2));
+  REQUIRE(rational( 0, 1) * rational( 9, 4) == rational( 0, 1));
+  REQUIRE(rational( 2, 3) * 6               == rational( 4, 1));
+  REQUIRE(rational( 2, 3) / -4              == rational(-1, 6));
+  REQUIRE((rational(2, 3) / -4).denominator() == 6);
+
+  // The intermediates 2^30 * 3 and 2^30 * 7 would overflow 32 bits, the reduced results do not.
+  REQUIRE(rational(1 << 30, 3) * rational(3, 1 << 30) == rational(1, 1));
+  REQUIRE(rational(1 << 30, 3) / rational(1 << 30, 7) == rational(7, 3));
+  REQUIRE(rational(1 << 30, 3) * 3                    == rational(1 << 30, 1));
+}
+
+TEST_CASE("std::experimental::detail::gcd")
+{
+  using std::experimental::detail::gcd;
+
+  static_assert(gcd(12, 18) == 6);
+
+  for (std::int64_t lhs = -50; lhs <= 50; ++lhs)
+    for (std::int64_t rhs = -50; rhs <= 50; ++rhs)
+      REQUIRE(gcd(lhs, rhs) == std::gcd(lhs, rhs));
+
+  REQUIRE(gcd(std::uint32_t(1) << 31, std::uint32_t(3) << 20) == std::uint32_t(1) << 20);
+  REQUIRE(gcd(std::numeric_limits<std::int64_t>::min(), std::int64_t(6)) == 2);
+  REQUIRE((gcd(static_cast<unsigned __int128>(3) << 100, static_cast<unsigned __int128>(9) << 70) == static_cast<unsigned __int128>(3) << 70));
+
+  // Lehmer's gcd on 128-bit operands with a common factor of up to 64 bits.
+  std::mt19937_64 generator(0);
+  for (auto i = 0; i < 10000; ++i)
+  {
+    const auto factor = static_cast<unsigned __int128>(generator() >> (generator() % 64));
+    const auto lhs    = static_cast<unsigned __int128>(generator() >> (generator() % 64)) * factor;
+    const auto rhs    = static_cast<unsigned __int128>(generator() >> (generator() % 64)) * factor;
+    REQUIRE((gcd(lhs, rhs) == std::gcd(lhs, rhs)));
+    REQUIRE((gcd(static_cast<__int128>(lhs), -static_cast<__int128>(rhs)) == static_cast<__int128>(std::gcd(lhs, rhs))));
+  }
+}
+
+TEST_CASE("std::experimental::rational overflow policies")
+{
+  using namespace std::experimental;
+
+  constexpr auto maximum = std::numeric_limits<std::int32_t>::max();
+  constexpr auto minimum = std::numeric_limits<std::int32_t>::min();
+
+  using unchecked = rational<std::int32_t, unchecked_policy>;
+  REQUIRE(unchecked(1, 3) + unchecked(1, 6) == unchecked(1, 2));
+
+  // Below, the intermediate t = 2 * (2^31 - 1) of (2^31 - 1) / 2 + (2^31 - 1) / 2 overflows, the result 2^31 - 1 does not: The
+  // checked policies throw and saturate respectively, promote_policy evaluates it in 64 bits.
+  using checked_throw = rational<std::int32_t, checked_throw_policy>;
+  REQUIRE      (checked_throw(1, 3) + checked_throw(1, 6) == checked_throw(1, 2));
+  REQUIRE_THROWS_AS(checked_throw(maximum, 2) + checked_throw(maximum, 2), std::overflow_error);
+  REQUIRE_THROWS_AS(checked_throw(maximum, 1) * 2                        , std::overflow_error);
+  REQUIRE_THROWS_AS(++checked_throw(maximum, 1)                          , std::overflow_error);
+  // Moving the sign of the denominator -2^31 to the numerator, and negating the numerator -2^31, overflow.
+  REQUIRE      (checked_throw(2, minimum) == checked_throw(-1, 1 << 30));
+  REQUIRE_THROWS_AS(checked_throw(1, minimum)                            , std::overflow_error);
+  REQUIRE_THROWS_AS(checked_throw(1) / checked_throw(minimum)            , std::overflow_error);
+  REQUIRE_THROWS_AS(checked_throw(3, 7) / checked_throw(minimum)         , std::overflow_error);
+  REQUIRE_THROWS_AS(checked_throw(1) / minimum                           , std::overflow_error);
+  REQUIRE_THROWS_AS(-checked_throw(minimum)                              , std::overflow_error);
+  REQUIRE_THROWS_AS(~checked_throw(minimum)                              , std::overflow_error);
+  REQUIRE_THROWS_AS(static_cast<void>(abs(checked_throw(minimum)))       , std::overflow_error);
+
+  using checked_saturate = rational<std::int32_t, checked_saturate_policy>;
+  REQUIRE(checked_saturate( maximum, 2) + checked_saturate(maximum, 2) == checked_saturate( maximum, 1));
+  REQUIRE(checked_saturate( maximum, 1) * 4                            == checked_saturate( maximum, 1));
+  REQUIRE(checked_saturate(-maximum, 1) * 4                            == checked_saturate(-maximum - 1, 1));
+  REQUIRE(checked_saturate(1, maximum)  / 4                            == checked_saturate(1, maximum));
+  REQUIRE(checked_saturate(1, minimum)                                 == checked_saturate(-1, maximum));
+  REQUIRE(checked_saturate(1) / checked_saturate(minimum)              == checked_saturate(-1, maximum));
+  REQUIRE(checked_saturate(3, 7) / checked_saturate(minimum)           == checked_saturate(-3, maximum));
+  REQUIRE(checked_saturate(1) / minimum                                == checked_saturate(-1, maximum));
+  REQUIRE(-checked_saturate(minimum)                                   == checked_saturate( maximum));
+  REQUIRE(~checked_saturate(minimum)                                   == checked_saturate(-1, maximum));
+  REQUIRE(abs(checked_saturate(minimum, 3))                            == checked_saturate( maximum, 3));
+  // The saturated 2^15 - 1 = 7 * 31 * 151 shares a factor with the denominator, which is canonized.
+  using narrow_saturate = rational<std::int16_t, checked_saturate_policy>;
+  REQUIRE((-narrow_saturate(std::numeric_limits<std::int16_t>::min(), 7)).denominator() == 1);
+  REQUIRE(  narrow_saturate(7, std::numeric_limits<std::int16_t>::min()).denominator()  == 4681);
+
+  using promote = rational<std::int32_t, promote_policy>;
+  REQUIRE      (promote(maximum, 2) + promote(maximum, 2) == promote(maximum, 1));
+  REQUIRE      (promote(maximum, 3) * promote(3, maximum) == promote(1      , 1));
+  REQUIRE_THROWS_AS(promote(maximum, 1) + 1               , std::overflow_error);
+  REQUIRE_THROWS_AS(promote(1, maximum) / 2               , std::overflow_error);
+  REQUIRE_THROWS_AS(promote(1, minimum)                   , std::overflow_error);
+  REQUIRE_THROWS_AS(promote(1) / promote(minimum)         , std::overflow_error);
+  REQUIRE_THROWS_AS(promote(3, 7) / promote(minimum)      , std::overflow_error);
+  REQUIRE_THROWS_AS(-promote(minimum)                     , std::overflow_error);
+  REQUIRE_THROWS_AS(~promote(minimum)                     , std::overflow_error);
+}
+
+#if defined(__cpp_lib_expected)
+TEST_CASE("std::experimental::rational exception-free interface")
+{
+  using rational = std::experimental::rational<std::int32_t>;
+  using std::experimental::rational_errc;
+
+  REQUIRE(rational::make(2, 4)          == rational(1, 2));
+  REQUIRE(rational::make(1, 0).error()  == rational_errc::zero_denominator);
+  REQUIRE(std::experimental::rational<std::int64_t>::make(0.5)                                      == std::experimental::rational<std::int64_t>(1, 2));
+  REQUIRE(std::experimental::rational<std::int64_t>::make(std::numeric_limits<double>::infinity()).error() == rational_errc::not_finite);
+
+  rational value(1, 2);
+  REQUIRE( value.try_assign     (3, 6));
+  REQUIRE(!value.try_assign     (3, 0));
+  REQUIRE(!value.try_denominator(0)   );
+  REQUIRE( value.try_denominator(4)   );
+  REQUIRE( value == rational(1, 4));
+
+  REQUIRE(value.try_divide(rational(1, 2))         == rational(1, 2));
+  REQUIRE(value.try_divide(2)                      == rational(1, 8));
+  REQUIRE(value.try_divide(rational(0, 1)).error() == rational_errc::division_by_zero);
+  REQUIRE(value.try_divide(0)             .error() == rational_errc::division_by_zero);
+}
+#endif
+
+TEST_CASE("std::experimental::rational constant evaluation")
+{
+  using namespace std::experimental;
+  using rational = std::experimental::rational<std::int64_t>;
+
+  // Arithmetic.
+  static_assert(rational(1, 2) + rational(1, 3) == rational( 5, 6));
+  static_assert(rational(1, 2) - rational(1, 3) == rational( 1, 6));
+  static_assert(rational(2, 3) * rational(3, 4) == rational( 1, 2));
+  static_assert(rational(2, 3) / rational(4, 3) == rational( 1, 2));
+  static_assert(rational(1, 2) + std::int64_t(1) == rational( 3, 2));
+  static_assert(std::int64_t(2) - rational(1, 2) == rational( 3, 2));
+  static_assert(rational(1, 2) * std::int64_t(4) == rational( 2, 1));
+  static_assert(rational(1, 2) / std::int64_t(4) == rational( 1, 8));
+  static_assert(++rational(1, 2)                == rational( 3, 2));
+  static_assert(--rational(1, 2)                == rational(-1, 2));
+  static_assert(-rational(1, 2)                 == rational(-1, 2));
+  static_assert(~rational(1, 2)                 == rational( 2, 1));
+  static_assert(abs(rational(-1, 2))            == rational( 1, 2));
+  static_assert(pow(rational(2, 3), std::int64_t(-2)) == rational(9, 4));
+  static_assert(std::experimental::rational<int, checked_throw_policy>(44100, 48000) * 2 == std::experimental::rational<int, checked_throw_policy>(147, 80));
+  static_assert(std::experimental::rational<int, promote_policy      >(44100, 48000) * 2 == std::experimental::rational<int, promote_policy      >(147, 80));
+
+  // Comparison.
+  static_assert(rational(1, 2) <  rational(2, 3));
+  static_assert(rational(1, 2) >= rational(2, 4));
+  static_assert(rational(4, 2) == std::int64_t(2));
+  static_assert(rational(3, 2) >  std::int64_t(1));
+
+  // Conversion.
+  static_assert(rational( 0.75 ) == rational(3, 4));
+  static_assert(rational(-0.1f ) == rational(-13421773, 134217728));
+  static_assert(rational( 1e10 ) == rational(10000000000, 1));
+  static_assert(rational(1, 4).evaluate<double>()  == 0.25 );
+  static_assert(rational_cast<float>(rational(3, 8)) == 0.375f);
+  static_assert(rational_cast<std::int64_t>(0.5)   == rational(1, 2));
+  static_assert(numerator(rational(6, 4)) == 3 && denominator(rational(6, 4)) == 2);
+
+  // Precomputed tables.
+  constexpr std::array<rational, 3> resampling_ratios {rational(44100, 48000), rational(48000, 96000), rational(22050, 44100)};
+  static_assert(resampling_ratios[0] == rational(147, 160) && resampling_ratios[2] == rational(1, 2));
+}
+
+TEST_CASE("std::experimental::rational floating point conversion")
+{
+  using rational = std::experimental::rational<std::int32_t>;
+
+  REQUIRE(rational(  0.5 ) == rational( 1, 2));
+  REQUIRE(rational(-12.25) == rational(-49, 4));
+  REQUIRE(rational(  0.0 ) == rational( 0, 1));
+
+  // The denominator is limited to 2^30, the numerator rounded to nearest.
+  REQUIRE(rational(0.1) == rational(107374182, 1073741824));
+  REQUIRE_THROWS_AS(rational(1e10 ), std::overflow_error);
+  REQUIRE_THROWS_AS(rational(1e-20), std::domain_error  );
+}
+
+TEST_CASE("std::experimental::rational comparison")
+{
+  constexpr auto maximum = std::numeric_limits<std::int64_t>::max();
+
+  // The cross-products of these overflow 64 bits.
+  using rational = std::experimental::rational<std::int64_t>;
+  REQUIRE(rational(maximum    , maximum - 1) <  rational(maximum - 1, maximum - 2));
+  REQUIRE(rational(-maximum   , maximum - 1) >  rational(1 - maximum, maximum - 2));
+  REQUIRE(rational(maximum    , 3)           >  maximum / 3);
+  REQUIRE(rational(maximum - 1, 3)           <  maximum / 3 + 1);
+  REQUIRE(rational(-maximum   , 2)           <  -(maximum / 2));
+
+  // The continued fraction comparison (no wider type available) against the widened cross-products.
+  using wide = std::experimental::rational<__int128>;
+  const auto huge = static_cast<__int128>(maximum) * maximum;
+  REQUIRE((wide(huge, huge - 1) < wide(huge - 1, huge - 2)));
+  REQUIRE((wide(-huge, 3)       < wide(-huge + 1, 3)));
+  REQUIRE((wide(huge, 5)        > static_cast<__int128>(huge / 5)));
+
+  std::mt19937_64 generator(0);
+  std::uniform_int_distribution<std::int64_t> numerators  (-1000000, 1000000);
+  std::uniform_int_distribution<std::int64_t> denominators(       1, 1000000);
+  for (auto i = 0; i < 100000; ++i)
+  {
+    const auto a = numerators(generator), b = denominators(generator), c = numerators(generator), d = denominators(generator);
+    REQUIRE((std::experimental::detail::compare_fractions<__int128>(a, b, c, d) == (a * d <=> b * c)));
+  }
+}
+
+TEST_CASE("std::experimental::rational IEEE-754 conversion")
+{
+  using rational = std::experimental::rational<std::int64_t>;
+  using wide     = std::experimental::rational<__int128>;
+
+  REQUIRE(rational( 0.1f             ) == rational( 13421773, 134217728));
+  REQUIRE(rational(-0.0              ) == rational( 0, 1));
+  REQUIRE(rational(std::ldexp(3.0, 60)) == rational( std::int64_t(3) << 60, 1));
+  REQUIRE(rational(std::ldexp(1.0,-62)) == rational( 1, std::int64_t(1) << 62));
+  REQUIRE((wide(std::ldexp(1.0, 100)) == wide(static_cast<__int128>(1) << 100, 1)));
+
+  // Subnormals decompose correctly, but their denominators do not fit any integer type, hence underflow.
+#if defined(__cpp_lib_expected)
+  using std::experimental::rational_errc;
+  REQUIRE(rational::make(std::numeric_limits<double>::denorm_min()).error() == rational_errc::underflow );
+  REQUIRE(wide    ::make(std::numeric_limits<float >::denorm_min()).error() == rational_errc::underflow );
+  REQUIRE(rational::make(std::numeric_limits<double>::quiet_NaN ()).error() == rational_errc::not_finite);
+  REQUIRE(rational::make(std::numeric_limits<float >::max       ()).error() == rational_errc::overflow  );
+  REQUIRE(std::experimental::rational<std::uint32_t>::make(-1.0f).error()   == rational_errc::overflow  );
+#endif
+
+  // Excess bits below the least denominator's reciprocal 2^-30 are rounded to nearest, ties to even.
+  using narrow = std::experimental::rational<std::int32_t>;
+  REQUIRE(narrow(std::ldexp(5.0, -31)) == narrow(1, 1 << 29));
+  REQUIRE(narrow(std::ldexp(3.0, -31)) == narrow(1, 1 << 29));
+  REQUIRE(narrow(std::ldexp(7.0, -32)) == narrow(1, 1 << 29));
+  REQUIRE(narrow(std::ldexp(7.0, -31)) == narrow(1, 1 << 28));
+  REQUIRE(narrow(std::ldexp(5.0, -32)) == narrow(1, 1 << 30));
+  REQUIRE_THROWS_AS(narrow(std::ldexp(1.0, -31)), std::domain_error);
+  // Rounding carries into the integer part, whose width must be checked after the trailing zeros are moved to the exponent.
+  REQUIRE(narrow(2.0 + std::ldexp(1.0, -31)) == narrow(2));
+  REQUIRE(narrow(2.0 + std::ldexp(1.0, -31)).denominator() == 1);
+  REQUIRE(narrow(std::ldexp(1.0, 22) - std::ldexp(1.0, -31)) == narrow(1 << 22));
+#if defined(__cpp_lib_expected)
+  REQUIRE(narrow::make(2.0 + std::ldexp(1.0, -31)).value() == narrow(2));
+#endif
+
+  // Round trip of random doubles that fit exactly.
+  std::mt19937_64 generator(0);
+  std::uniform_int_distribution<std::int64_t> numerators(-(std::int64_t(1) << 53), std::int64_t(1) << 53);
+  std::uniform_int_distribution<int>          exponents (-9, 9);
+  for (auto i = 0; i < 10000; ++i)
+  {
+    const auto value = std::ldexp(static_cast<double>(numerators(generator)), exponents(generator));
+    REQUIRE(rational(value).evaluate<double>() == value);
+  }
+}
+
+TEST_CASE("std::experimental::rational correctly rounded conversion")
+{
+  using rational = std::experimental::rational<std::int64_t>;
+  using exact    = std::experimental::rational<__int128>;
+
+  // The exact value must lie between the midpoints to the neighboring doubles (ties to even aside).
+  const auto check = [ ] (const rational& value)
+  {
+    const auto result = value.to_double();
+    const auto lower  = (exact(result) + exact(std::nextafter(result, -HUGE_VAL))) / static_cast<__int128>(2);
+    const auto upper  = (exact(result) + exact(std::nextafter(result,  HUGE_VAL))) / static_cast<__int128>(2);
+    const auto target = exact(value.numerator(), value.denominator());
+    REQUIRE((lower <= target && target <= upper));
+
+    const auto down = value.to_double(std::round_toward_neg_infinity);
+    const auto up   = value.to_double(std::round_toward_infinity    );
+    REQUIRE((exact(down) <= target && target <= exact(up)));
+    REQUIRE((down == up || std::nextafter(down, HUGE_VAL) == up));
+    REQUIRE(value.to_double(std::round_toward_zero) == (value.numerator() < 0 ? up : down));
+  };
+
+  std::mt19937_64 generator(0);
+  for (auto i = 0; i < 10000; ++i)
+  {
+    const auto numerator   = static_cast<std::int64_t>(generator() >> (generator() % 64)) * (generator() % 2 ? 1 : -1);
+    const auto denominator = static_cast<std::int64_t>(generator() >> (generator() % 63 + 1)) + 1;
+    if (numerator != 0)
+      check(rational(numerator, denominator));
+  }
+
+  // Converting the numerator and the denominator separately rounds twice: (2^62 + 2^9 + 1) / 3.
+  check(rational((std::int64_t(1) << 62) + (1 << 9) + 1, 3));
+  REQUIRE(rational(1, 3).to_float(std::round_toward_zero) <  rational(1, 3).to_float(std::round_toward_infinity));
+  REQUIRE(rational(1, 3).to_float()                       == 1.0f / 3.0f);
+  REQUIRE(rational(-1, 3).evaluate<double>()              == -1.0 / 3.0);
+  REQUIRE(std::experimental::rational<__int128>(1, static_cast<__int128>(1) << 126).to_double() == std::ldexp(1.0, -126));
+}
+
+TEST_CASE("std::experimental::rational approximation")
+{
+  using rational = std::experimental::rational<std::int64_t>;
+
+  // Python: Fraction('3.141592653589793').limit_denominator(n).
+  REQUIRE(rational::approximate(3.141592653589793, 10     ) == rational(22    , 7    ));
+  REQUIRE(rational::approximate(3.141592653589793, 100    ) == rational(311   , 99   ));
+  REQUIRE(rational::approximate(3.141592653589793, 1000   ) == rational(355   , 113  ));
+  REQUIRE(rational::approximate(-3.141592653589793, 1000  ) == rational(-355  , 113  ));
+  REQUIRE(rational::approximate(0.1                , 1000 ) == rational(1     , 10   ));
+  REQUIRE(rational::approximate(1e-300             , 1000 ) == rational(0));
+  REQUIRE(rational(1, 3).limit_denominator(100)             == rational(1     , 3    ));
+  REQUIRE(rational(std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max()).limit_denominator(10) == rational(-1));
+  REQUIRE_THROWS(static_cast<void>(rational(1, 3).limit_denominator(0)));
+
+  // The result is the closest fraction of bounded denominator (compared against a brute force search).
+  std::mt19937_64                             generator(0);
+  std::uniform_int_distribution<std::int64_t> distribution(-1'000'000, 1'000'000);
+  for (auto i = 0; i < 200; ++i)
+  {
+    const auto value  = rational(distribution(generator), distribution(generator) % 1'000'000 + 1'000'001);
+    const auto result = value.limit_denominator(50);
+    REQUIRE(result.denominator() <= 50);
+    for (std::int64_t denominator = 1; denominator <= 50; ++denominator)
+    {
+      const auto numerator = static_cast<std::int64_t>(std::floor(value.evaluate<double>() * static_cast<double>(denominator)));
+      for (const auto candidate : {rational(numerator, denominator), rational(numerator + 1, denominator)})
+        REQUIRE(abs(result - value) <= abs(candidate - value));
+    }
+  }
+
+  // The tolerance variant yields the first convergent within the tolerance.
+  REQUIRE(rational::approximate(3.141592653589793, 1e-2 ) == rational(22    , 7    ));
+  REQUIRE(rational::approximate(3.141592653589793, 1e-6 ) == rational(355   , 113  ));
+  REQUIRE(rational::approximate(-0.75              , 0.0  ) == rational(-3    , 4    ));
+  REQUIRE(rational::approximate(0.1                , 0.0  ) == rational(1     , 10   )); // 1.0 / 10.0 == 0.1 in floating point.
+  REQUIRE(std::experimental::rational<std::int32_t>::approximate(1e-12, 0.0) == std::experimental::rational<std::int32_t>(0));
+  REQUIRE_THROWS(static_cast<void>(rational::approximate(1e19, 1.0)));
+}
+
+TEST_CASE("std::experimental::rational character conversion")
+{
+  using rational = std::experimental::rational<std::int64_t>;
+
+  const auto parse = [ ] (const std::string_view text, const std::size_t length, const std::errc error, const rational& expected)
+  {
+    INFO(text);
+    auto value  = rational(42);
+    auto result = from_chars(text.data(), text.data() + text.size(), value);
+    REQUIRE(result.ec  == error);
+    REQUIRE(result.ptr == text.data() + length);
+    REQUIRE(value      == expected);
+  };
+
+  parse("3"        , 1, std::errc(), rational(3));
+  parse("-3/6"     , 4, std::errc(), rational(-1, 2));
+  parse("1.25"     , 4, std::errc(), rational(5, 4));
+  parse("-0.100,"  , 6, std::errc(), rational(-1, 10));
+  parse("1 3/4"    , 5, std::errc(), rational(7, 4));
+  parse("-1 3/4"   , 6, std::errc(), rational(-7, 4));
+  parse("1 3"      , 1, std::errc(), rational(1));
+  parse("1/x"      , 1, std::errc(), rational(1));
+  parse("2."       , 1, std::errc(), rational(2));
+  parse("0.50000000000000000000000000", 28, std::errc(), rational(1, 2));
+  parse("-9223372036854775808/1", 22, std::errc(), rational(std::numeric_limits<std::int64_t>::min()));
+  parse("18446744073709551614/2", 22, std::errc(), rational(std::numeric_limits<std::int64_t>::max()));
+  parse("9223372036854775808"   , 19, std::errc::result_out_of_range, rational(42));
+  parse("-0/99930699852256902088"  , 23, std::errc(), rational(0));
+  parse("0 0/99930699852256902088" , 24, std::errc(), rational(0));
+  parse("99930699852256902088/99930699852256902088", 41, std::errc::result_out_of_range, rational(42));
+  parse("1/0"      , 0, std::errc::invalid_argument  , rational(42));
+  parse("99999999999999999999/0"  , 0, std::errc::invalid_argument  , rational(42));
+  parse("1 99999999999999999999/0", 0, std::errc::invalid_argument  , rational(42));
+  parse("x"        , 0, std::errc::invalid_argument  , rational(42));
+  parse("-"        , 0, std::errc::invalid_argument  , rational(42));
+
+  std::experimental::rational<unsigned> unsigned_value;
+  const std::string_view negative = "-1";
+  REQUIRE(from_chars(negative.data(), negative.data() + negative.size(), unsigned_value).ec == std::errc::invalid_argument);
+
+  // Round trip.
+  std::array<char, 64> buffer {};
+  std::mt19937_64 generator(0);
+  for (auto i = 0; i < 1000; ++i)
+  {
+    const auto value  = rational(static_cast<std::int64_t>(generator()), static_cast<std::int64_t>(generator() >> 1) + 1);
+    const auto result = to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    REQUIRE(result.ec == std::errc());
+
+    rational parsed;
+    REQUIRE(from_chars(buffer.data(), result.ptr, parsed).ptr == result.ptr);
+    REQUIRE(parsed == value);
+  }
+
+  const auto huge = std::experimental::rational<__int128>(-(static_cast<__int128>(1) << 100), 3);
+  const auto end  = to_chars(buffer.data(), buffer.data() + buffer.size(), huge).ptr;
+  REQUIRE(std::string_view(buffer.data(), end) == "-1267650600228229401496703205376/3");
+  std::experimental::rational<__int128> parsed_huge;
+  from_chars(buffer.data(), end, parsed_huge);
+  REQUIRE((parsed_huge == huge));
+
+  REQUIRE(to_chars(buffer.data(), buffer.data() + 3, rational(-1, 2)).ec == std::errc::value_too_large);
+  REQUIRE(to_chars(buffer.data(), buffer.data() + 4, rational(-1, 2)).ptr == buffer.data() + 4);
+}
+
+TEST_CASE("std::experimental::rational formatting")
+{
+  // Exact decimal digits, with and without a wider integer type.
+  std::string digits;
+  std::experimental::detail::write_fraction_digits(std::back_inserter(digits), 1u, 7u, 12);
+  REQUIRE(digits == "142857142857");
+  digits.clear();
+  const auto maximum = static_cast<unsigned __int128>(std::numeric_limits<__int128>::max());
+  std::experimental::detail::write_fraction_digits(std::back_inserter(digits), maximum - 1, maximum, 40);
+  REQUIRE(digits == "9999999999999999999999999999999999999941");
+
+  // The format specification and the formatting itself, which do not depend on <format>.
+  using rational = std::experimental::rational<std::int64_t>;
+  const auto format = [ ] (const std::string_view specification_text, const rational& value)
+  {
+    std::experimental::detail::format_specification<char> specification;
+    auto current = specification_text.begin();
+    if (!std::experimental::detail::parse_format_specification(current, specification_text.end(), specification))
+      return std::string("invalid");
+    std::string result;
+    std::experimental::detail::format_rational(std::back_inserter(result), value.numerator(), value.denominator(), specification);
+    return result;
+  };
+  REQUIRE(format(""      , rational( 3, 2)) == "3/2"         );
+  REQUIRE(format("f"     , rational(-3, 2)) == "-3/2"        );
+  REQUIRE(format("m"     , rational(-3, 2)) == "-1 1/2"      );
+  REQUIRE(format("m"     , rational(-1, 2)) == "-1/2"        );
+  REQUIRE(format("m"     , rational( 4)   ) == "4"           );
+  REQUIRE(format(".5"    , rational(-1, 3)) == "-0.33333"    );
+  REQUIRE(format(".0"    , rational( 7, 2)) == "3"           );
+  REQUIRE(format("m:x"   , rational(31,16)) == "1 f/10"      );
+  REQUIRE(format("m:#X"  , rational(31,16)) == "0X1 0XF/0X10");
+  REQUIRE(format(":o"    , rational( 0)   ) == "0/1"         );
+  // The numerator (and whole part) and the denominator are formatted by their own integer specifications.
+  REQUIRE(format(":x/d"  , rational(31,16)) == "1f/16"       );
+  REQUIRE(format("m:/#b" , rational( 7, 4)) == "1 3/0b100"   );
+  REQUIRE(format(":03/4" , rational(-1, 2)) == "-001/   2"   );
+  REQUIRE(format(":#06x" , rational(15,16)) == "0x000f/0x0010");
+  REQUIRE(format(".2:03" , rational( 1, 2)) == "000.50"      );
+  REQUIRE(format(":#o"   , rational( 0)   ) == "0/01"        );
+  REQUIRE(format("9:02/" , rational( 1, 2)) == "     01/2"   );
+  // The sign is written once, the width and the fill apply to the whole result.
+  REQUIRE(format("+.2"   , rational(-1, 2)) == "-0.50"       );
+  REQUIRE(format("+.2"   , rational( 1, 2)) == "+0.50"       );
+  REQUIRE(format(" m"    , rational( 3, 2)) == " 1 1/2"      );
+  REQUIRE(format("7"     , rational( 1, 2)) == "    1/2"     );
+  REQUIRE(format("<7"    , rational( 1, 2)) == "1/2    "     );
+  REQUIRE(format("*^9m"  , rational(-3, 2)) == "*-1 1/2**"   );
+  REQUIRE(format("_>+8.2", rational( 1, 2)) == "___+0.50"    );
+  REQUIRE(format("2"     , rational(-3, 2)) == "-3/2"        );
+  REQUIRE(format("q"     , rational( 1)   ) == "invalid"     );
+  REQUIRE(format("."     , rational( 1)   ) == "invalid"     );
+  REQUIRE(format("m:+"   , rational( 1)   ) == "invalid"     );
+  REQUIRE(format("08"    , rational( 1)   ) == "invalid"     );
+  REQUIRE(format(":x/q"  , rational( 1)   ) == "invalid"     );
+  REQUIRE(format(":x/d/d", rational( 1)   ) == "invalid"     );
+
+  // std::format uses the above (tested where the standard library provides <format>, see CMakeLists.txt).
+#if defined(__cpp_lib_format)
+  REQUIRE(std::format("{}"      , rational( 3, 2)) == "3/2"     );
+  REQUIRE(std::format("{:m:x}"  , rational(31,16)) == "1 f/10"  );
+  REQUIRE(std::format("{::03/4}", rational(-1, 2)) == "-001/   2");
+  REQUIRE(std::format("{:+.2}"  , rational(-1, 2)) == "-0.50"   );
+  REQUIRE(std::format("{:*^9m}" , rational(-3, 2)) == "*-1 1/2**");
+  REQUIRE(std::format(L"{:>6}"  , rational( 1, 2)) == L"   1/2" );
+  const auto one = rational(1);
+  REQUIRE_THROWS_AS(static_cast<void>(std::vformat("{:q}", std::make_format_args(one))), std::format_error);
+#endif
+}
+
+TEST_CASE("std::experimental::rational_accumulator")
+{
+  using rational    = std::experimental::rational<std::int32_t>;
+  using reference   = std::experimental::rational<std::int64_t>;
+  using accumulator = std::experimental::rational_accumulator<std::int32_t>;
+
+  // Sums and products with small denominators, which overflow the unreduced 32-bit terms repeatedly.
+  std::mt19937                                generator(0);
+  std::uniform_int_distribution<std::int32_t> numerators  (-20, 20);
+  std::uniform_int_distribution<std::int32_t> denominators(1  , 12);
+
+  accumulator sum, difference;
+  reference   expected_sum, expected_difference;
+  for (auto i = 0; i < 1000; ++i)
+  {
+    const auto value = rational(numerators(generator), denominators(generator));
+    sum                 += value;
+    difference          -= value;
+    expected_sum        += reference(value.numerator(), value.denominator());
+    expected_difference -= reference(value.numerator(), value.denominator());
+  }
+  REQUIRE(sum       .value() == rational(static_cast<std::int32_t>(expected_sum       .numerator()), static_cast<std::int32_t>(expected_sum       .denominator())));
+  REQUIRE(difference.value() == rational(static_cast<std::int32_t>(expected_difference.numerator()), static_cast<std::int32_t>(expected_difference.denominator())));
+
+  accumulator product(rational(1));
+  for (auto i = 1; i <= 12; ++i)
+    product *= rational(i + 1, i); // Telescopes to 13.
+  REQUIRE(static_cast<rational>(product) == rational(13));
+
+  // Merging partial accumulators.
+  accumulator lhs(rational(1, 3)), rhs(rational(1, 6));
+  lhs += rhs;
+  REQUIRE(lhs.value() == rational(1, 2));
+  lhs *= accumulator(rational(4));
+  REQUIRE(lhs.value() == rational(2));
+
+  // Operations that overflow after reduction follow the overflow policy.
+  using checked_rational = std::experimental::rational<std::int32_t, std::experimental::checked_throw_policy>;
+  std::experimental::rational_accumulator<std::int32_t, std::experimental::checked_throw_policy> checked(checked_rational(std::numeric_limits<std::int32_t>::max()));
+  REQUIRE_THROWS_AS(checked += checked_rational(1), std::overflow_error);
+}
+
+TEST_CASE("std::experimental::rational fused multiply-add")
+{
+  using rational    = std::experimental::rational<std::int32_t>;
+  using reference   = std::experimental::rational<std::int64_t>;
+  using accumulator = std::experimental::rational_accumulator<std::int32_t>;
+
+  // Agrees with the separate operations where these do not overflow.
+  std::mt19937                                generator(0);
+  std::uniform_int_distribution<std::int32_t> numerators  (-1000, 1000);
+  std::uniform_int_distribution<std::int32_t> denominators(1    , 1000);
+  for (auto i = 0; i < 10000; ++i)
+  {
+    const rational a(numerators(generator), denominators(generator)), b(numerators(generator), denominators(generator)), c(numerators(generator), denominators(generator));
+    const auto expected = reference(a.numerator(), a.denominator()) * reference(b.numerator(), b.denominator()) + reference(c.numerator(), c.denominator());
+    REQUIRE(fma(a, b, c) == rational(static_cast<std::int32_t>(expected.numerator()), static_cast<std::int32_t>(expected.denominator())));
+
+  }
+
+  // Accumulated products with small denominators (whose sum fits), which overflow the unreduced 32-bit terms repeatedly.
+  std::uniform_int_distribution<std::int32_t> small_numerators  (-5, 5);
+  std::uniform_int_distribution<std::int32_t> small_denominators(1 , 6);
+  accumulator sum;
+  reference   expected_sum;
+  for (auto i = 0; i < 1000; ++i)
+  {
+    const rational x(small_numerators(generator), small_denominators(generator)), w(small_numerators(generator), small_denominators(generator));
+    sum.fma_assign(x, w);
+    expected_sum += reference(x.numerator(), x.denominator()) * reference(w.numerator(), w.denominator());
+  }
+  REQUIRE(sum.value() == rational(static_cast<std::int32_t>(expected_sum.numerator()), static_cast<std::int32_t>(expected_sum.denominator())));
+
+  // The product is not narrowed: (2m + 1)/m * 1/n - 1/n = 1/m, where the denominator of the product mn does not fit.
+  using checked = std::experimental::rational<std::int64_t, std::experimental::checked_throw_policy>;
+  constexpr std::int64_t m = std::int64_t(1) << 40, n = m + 1;
+  if constexpr (sizeof(std::experimental::detail::wider_t<std::int64_t>) > sizeof(std::int64_t))
+    REQUIRE(fma(checked(2 * m + 1, m), checked(1, n), checked(-1, n)) == checked(1, m));
+  REQUIRE_THROWS_AS(static_cast<void>(checked(2 * m + 1, m) * checked(1, n)), std::overflow_error);
+
+  // The addend shares a large factor with the denominator of the product, which the addition cancels before multiplying.
+  using promoted = std::experimental::rational<std::int64_t, std::experimental::promote_policy>;
+  const promoted x(-87266, 3461182544487896709), w(29957191234241, 54);
+  if constexpr (sizeof(std::experimental::detail::wider_t<std::int64_t>) > sizeof(std::int64_t))
+    REQUIRE(fma(x, w, x) == promoted(-100547855778922595, 7188609900090247011));
+
+  // In place, also if the arguments alias the result.
+  auto value = rational(1, 2);
+  value.fma_assign(value, value);
+  REQUIRE(value == rational(3, 4));
+}
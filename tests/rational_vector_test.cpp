@@ -0,0 +1,72 @@
+#include "internal/doctest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <ranges>
+
+#include <std/experimental/rational_vector.hpp>
+
+static_assert(std::ranges::random_access_range<std::experimental::rational_vector<int>>);
+static_assert(std::indirectly_writable<std::experimental::rational_vector<int>::iterator, std::experimental::rational<int>>);
+static_assert(std::sortable<std::experimental::rational_vector<int>::iterator>);
+
+TEST_CASE("std::experimental::rational_vector")
+{
+  using rational = std::experimental::rational<std::int32_t>;
+  using vector   = std::experimental::rational_vector<std::int32_t>;
+
+  vector values {rational(1, 2), rational(-2, 3), rational(5)};
+  REQUIRE(values.size() == 3);
+  REQUIRE(values[1] == rational(-2, 3));
+  REQUIRE(numerator  (values[1]) == -2);
+  REQUIRE(denominator(values[1]) ==  3);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(values.numerators  ().data()) % 64 == 0);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(values.denominators().data()) % 64 == 0);
+
+  // Proxy references convert to and assign from rationals.
+  values[0] += rational(1, 3);
+  REQUIRE(values[0] == rational(5, 6));
+  const rational copy = values[2];
+  REQUIRE(copy == rational(5));
+  values.push_back(rational(1, 7));
+  REQUIRE(std::accumulate(values.cbegin(), values.cend(), rational()) == rational(5, 6) - rational(2, 3) + rational(5) + rational(1, 7));
+  REQUIRE(values.reduce() == rational(5, 6) - rational(2, 3) + rational(5) + rational(1, 7));
+
+  std::sort(values.begin(), values.end(), [ ] (const rational& lhs, const rational& rhs) { return lhs < rhs; });
+  REQUIRE(std::is_sorted(values.cbegin(), values.cend()));
+  REQUIRE(values[0] == rational(-2, 3));
+
+  // Ranges algorithms.
+  vector copy_of(values.size());
+  std::ranges::copy(values, copy_of.begin());
+  std::ranges::sort(copy_of, std::ranges::greater());
+  REQUIRE(copy_of[0] == rational(5));
+  REQUIRE(copy_of[3] == rational(-2, 3));
+  std::ranges::reverse(copy_of);
+  REQUIRE(std::ranges::equal(copy_of, values));
+
+  // Bulk operations.
+  values.scale(rational(3, 2));
+  REQUIRE(values[0] == rational(-1));
+  REQUIRE(values[3] == rational(15, 2));
+  values.add(rational(2));
+  REQUIRE(values[0] == rational(1));
+  values.add(rational(1, 2));
+  REQUIRE(values[0] == rational(3, 2));
+
+  // Direct writes to the underlying arrays, followed by normalization.
+  std::mt19937 generator(0);
+  vector random(1000);
+  for (std::size_t i = 0; i < random.size(); ++i)
+  {
+    random.span().numerators  [i] = static_cast<std::int32_t>(generator() % 2001) - 1000;
+    random.span().denominators[i] = static_cast<std::int32_t>(generator() % 1000) + 1;
+  }
+  const auto numerators   = std::vector<std::int32_t>(random.numerators  ().begin(), random.numerators  ().end());
+  const auto denominators = std::vector<std::int32_t>(random.denominators().begin(), random.denominators().end());
+  random.normalize();
+  for (std::size_t i = 0; i < random.size(); ++i)
+    REQUIRE(random[i] == rational(numerators[i], denominators[i]));
+}